@@ -24,9 +24,9 @@ namespace Game
 		Layer::OnDetach();
 	}
 
-	void EditorLayer::OnUpdate()
+	void EditorLayer::OnUpdate(float alpha)
 	{
-		Layer::OnUpdate();
+		Layer::OnUpdate(alpha);
 	}
 
 	void EditorLayer::OnImGuiRender()
@@ -31,7 +31,7 @@ namespace Game
 		void OnAttach() override;
 		void OnDetach() override;
 
-		void OnUpdate() override;
+		void OnUpdate(float alpha) override;
 
 		void OnImGuiRender() override;
 		void OnEvent(Event &e) override;
@@ -76,6 +76,7 @@ project "Engine"
 
 		links
 		{
+			"winmm.lib",
 		}
 
 	filter "configurations:Debug"
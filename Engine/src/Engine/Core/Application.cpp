@@ -2,6 +2,9 @@
 #include "Application.h"
 
 #include "Log.h"
+#include "ImageIO.h"
+#include "MipChain.h"
+#include "PixelPool.h"
 
 #include "Engine/Lua/LuaRegister.h"
 
@@ -11,19 +14,29 @@
 #include "Engine/Layers/LogLayer.h"
 #include "Engine/Layers/StatisticLayer.h"
 
+#include "Engine/Devices/InputRecorder.h"
 #include "Engine/Devices/Keyboard.h"
 #include "Engine/Devices/Mouse.h"
 #include "Engine/Utils/LuaUtils.h"
 
+#include "Engine/OpenGL/FrameBuffer.h"
+#include "Engine/OpenGL/GLBackend.h"
+#include "Engine/OpenGL/RenderBuffer.h"
+#include "Engine/OpenGL/ShaderCompiler.h"
+#include "Engine/OpenGL/ShaderReloader.h"
+#include "Engine/OpenGL/TextureLoader.h"
+
+#include "Engine/Renderer/GpuProfiler.h"
+
 #include "Engine/Events/ApplicationEvent.h"
 
+#include <charconv>
 #include <lua.hpp>
 #include <GLFW/glfw3.h>
 
 // #include "Renderer.h"
 
 #include "ImGui.h"
-// #include "TextureLoader.h"
 
 namespace
 {
@@ -101,13 +114,30 @@ namespace
 		}
 	}
 
+	Game::Window* GetScriptWindow()
+	{
+		auto &application = Game::Application::Get();
+
+		if(!application.HasWindow())
+		{
+			SCRIPT_LOG_WARN("There is no window in headless mode");
+			return nullptr;
+		}
+
+		return &application.GetWindow();
+	}
+
 	void EnableInputMode(int inputMode)
 	{
+		const auto window = GetScriptWindow();
+		if(!window)
+			return;
+
 		if(inputMode == static_cast<int>(Game::InputMode::LockKeyModes) || inputMode == static_cast<int>(
 				Game::InputMode::RawMouseMotion) || inputMode == static_cast<int>(Game::InputMode::StickyKeys) ||
 			inputMode
 			== static_cast<int>(Game::InputMode::StickyMouseButtons))
-			Game::Application::Get().GetWindow().SetInputMode(true, static_cast<Game::InputMode>(inputMode));
+			window->SetInputMode(true, static_cast<Game::InputMode>(inputMode));
 		else
 			SCRIPT_LOG_ERROR(
 		                 "Unknown input mode: {}, Expected: {}, {}, {} or {}",
@@ -121,11 +151,15 @@ namespace
 
 	void DisableInputMode(int inputMode)
 	{
+		const auto window = GetScriptWindow();
+		if(!window)
+			return;
+
 		if(inputMode == static_cast<int>(Game::InputMode::LockKeyModes) || inputMode == static_cast<int>(
 				Game::InputMode::RawMouseMotion) || inputMode == static_cast<int>(Game::InputMode::StickyKeys) ||
 			inputMode
 			== static_cast<int>(Game::InputMode::StickyMouseButtons))
-			Game::Application::Get().GetWindow().SetInputMode(false, static_cast<Game::InputMode>(inputMode));
+			window->SetInputMode(false, static_cast<Game::InputMode>(inputMode));
 		else
 			SCRIPT_LOG_ERROR(
 		                 "Unknown input mode: {}, Expected: {}, {}, {} or {}",
@@ -139,11 +173,15 @@ namespace
 
 	bool GetInputMode(int inputMode)
 	{
+		const auto window = GetScriptWindow();
+		if(!window)
+			return false;
+
 		if(inputMode == static_cast<int>(Game::InputMode::LockKeyModes) || inputMode == static_cast<int>(
 				Game::InputMode::RawMouseMotion) || inputMode == static_cast<int>(Game::InputMode::StickyKeys) ||
 			inputMode
 			== static_cast<int>(Game::InputMode::StickyMouseButtons))
-			Game::Application::Get().GetWindow().GetInputMode(static_cast<Game::InputMode>(inputMode));
+			return window->GetInputMode(static_cast<Game::InputMode>(inputMode));
 		else
 			SCRIPT_LOG_ERROR(
 		                 "Unknown input mode: {}, Expected: {}, {}, {} or {}",
@@ -159,9 +197,13 @@ namespace
 
 	void SetCursorMode(int cursorMode)
 	{
+		const auto window = GetScriptWindow();
+		if(!window)
+			return;
+
 		if(cursorMode == static_cast<int>(Game::CursorMode::Normal) || cursorMode == static_cast<int>(
 			Game::CursorMode::Hidden) || cursorMode == static_cast<int>(Game::CursorMode::Disabled))
-			Game::Application::Get().GetWindow().SetCursorMode(static_cast<Game::CursorMode>(cursorMode));
+			window->SetCursorMode(static_cast<Game::CursorMode>(cursorMode));
 		else
 			SCRIPT_LOG_ERROR(
 		                 "Unknown Cursor mode: {}, Expected: {}, {}, {}",
@@ -174,7 +216,8 @@ namespace
 
 	int GetCursorMode()
 	{
-		return static_cast<int>(Game::Application::Get().GetWindow().GetCursorMode());
+		const auto window = GetScriptWindow();
+		return static_cast<int>(window ? window->GetCursorMode() : Game::CursorMode::Normal);
 	}
 
 	void DebugCallback(
@@ -212,15 +255,42 @@ namespace Game
 	Application::Application(const ApplicationSpecification &specification) : m_Specification(specification)
 	{
 		s_Instance = this;
+
+		m_UpdateChannel = m_Scheduler.Add(
+		                                  "Update",
+		                                  60.f,
+		                                  [this](const Time &step)
+		                                  {
+			                                  GPU_ZONE("Fixed update");
+
+			                                  InputRecorder::Tick();
+
+			                                  for(Pointer<Layer> &layer : m_LayerStack)
+				                                  layer->OnConstUpdate(step);
+		                                  }
+		                                 );
 	}
 
 	Application::~Application()
 	{
-		// TextureLoader::ClearCashed();
+		InputRecorder::Stop();
+		m_FramePacer.Reset();
+		m_Offscreen = nullptr;
+
+		TextureLoader::ClearCashed();
+		TextureLoader::Shutdown();
+		ImageIO::Shutdown();
+		MipChain::SetThreadPool(nullptr);
+		PixelPool::Trim();
+		ShaderReloader::Shutdown();
+		GpuProfiler::Shutdown();
 	}
 
 	void Application::OnEvent(Event &event)
 	{
+		if(!InputRecorder::OnEvent(event))
+			return;
+
 		EventDispatcher dispatcher(event);
 
 		dispatcher.Dispatch<WindowCloseEvent>(BIND_EVENT_FN(Application::OnWindowClose));
@@ -275,51 +345,95 @@ namespace Game
 
 	int Application::Run()
 	{
-		glfwSetTime(0.);
-
 		m_Clock.Restart();
 
 		Clock clock;
-		Clock updateClock;
-		uint32_t updateNext = updateClock.GetElapsedTime().AsMilliseconds();
+		m_Scheduler.Reset();
+
+		Clock frameClock;
+		std::vector<Time> frameTimes;
+
+		if(IsHeadless())
+			frameTimes.reserve(m_Specification.Frames);
 
 		while(m_Running)
 		{
-			m_Window->GetFunctions().Clear(BufferBit::Color | BufferBit::Depth);
+			// Input is polled after pacing so it is as fresh as possible when the frame starts
+			m_FramePacer.Wait();
+
+			if(m_Window)
+				m_Window->PollEvents();
+
+			frameClock.Restart();
+
+			if(m_Offscreen)
+				m_Offscreen->Bind(m_Offscreen->Size());
+
+			Context::GetContext()->GetFunctions().Clear(BufferBit::Color | BufferBit::Depth);
 			if(!m_Minimalized)
 			{
 				m_FrameTime = clock.Restart();
 
-				for(Pointer<Layer> &layer : m_LayerStack)
-				{
-					layer->OnUpdate();
-				}
+				GpuProfiler::BeginFrame();
+
+				ShaderCompiler::Poll();
+				ShaderReloader::Update();
+				TextureLoader::Update();
 
-				uint64_t updates = 0;
+				// Fixed steps run first so the frame is drawn between the two latest simulation states
+				m_Scheduler.Advance(m_FrameTime);
 
-				int32_t updateTime = updateClock.GetElapsedTime().AsMilliseconds();
-				while((updateTime - updateNext) >= m_UpdateRate && updates++ < m_MaxUpdates)
 				{
+					GPU_ZONE("Update");
+
+					const float alpha = m_Scheduler.GetAlpha(m_UpdateChannel);
+
 					for(Pointer<Layer> &layer : m_LayerStack)
-						layer->OnConstUpdate(Milliseconds(m_UpdateRate));
-					updateNext += m_UpdateRate;
+					{
+						layer->OnUpdate(alpha);
+					}
 				}
 
-				m_ImGuiLayer->Begin();
+				if(m_ImGuiLayer)
+				{
+					GPU_ZONE("ImGui");
+
+					m_ImGuiLayer->Begin();
 
-				if(s_ShowImGuiTest)
-					ImGui::ShowDemoWindow(&s_ShowImGuiTest);
+					if(s_ShowImGuiTest)
+						ImGui::ShowDemoWindow(&s_ShowImGuiTest);
 
-				for(Pointer<Layer> &layer : m_LayerStack)
-					layer->OnImGuiRender();
+					for(Pointer<Layer> &layer : m_LayerStack)
+						layer->OnImGuiRender();
 
 
-				m_ImGuiLayer->End();
+					m_ImGuiLayer->End();
+				}
+
+				GpuProfiler::EndFrame();
+
+				m_RenderTargets->Update();
 			}
 
-			m_Window->OnUpdate();
+			if(m_Window)
+				m_Window->SwapBuffers();
+
+			m_FramePacer.EndFrame();
+
+			if(IsHeadless())
+			{
+				frameTimes.emplace_back(frameClock.GetElapsedTime());
+
+				if(m_Specification.Frames > 0 && frameTimes.size() >= m_Specification.Frames)
+					Exit(0);
+				else if(m_Specification.Frames == 0 && InputRecorder::HasFinished())
+					Exit(0);
+			}
 		}
 
+		if(IsHeadless())
+			WriteReport(frameTimes);
+
 		return m_ExitCode;
 	}
 
@@ -327,13 +441,38 @@ namespace Game
 	{
 		for(int i = 0; i < args.Count; ++i)
 			m_Arguments.emplace_back(args[i]);
+
+		for(const auto &argument : m_Arguments)
+		{
+			if(argument == "--headless")
+				m_Specification.Headless = true;
+			else if(argument == "--null-gl")
+			{
+				m_Specification.Headless = true;
+				m_Specification.NullGL   = true;
+			}
+			else if(argument.starts_with("--frames="))
+			{
+				const auto value = std::string_view(argument).substr(9);
+				const auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), m_Specification.Frames);
+
+				if(error != std::errc() || end != value.data() + value.size())
+					LOG_WARN("Invalid frame count: \"{}\"", value);
+			}
+			else if(argument.starts_with("--report="))
+				m_Specification.ReportPath = argument.substr(9);
+			else if(argument.starts_with("--record="))
+				m_Specification.RecordInputPath = argument.substr(9);
+			else if(argument.starts_with("--replay="))
+				m_Specification.ReplayInputPath = argument.substr(9);
+		}
 	}
 
 	void Application::SetUpdateRate(float rate)
 	{
 		if(200 >= rate && 1 <= rate)
 		{
-			m_UpdateRate = static_cast<uint32_t>(1000.f / rate);
+			m_Scheduler.SetRate(m_UpdateChannel, rate);
 		}
 	}
 
@@ -341,7 +480,7 @@ namespace Game
 	{
 		if(200 >= maxUpdates && 1 <= maxUpdates)
 		{
-			m_MaxUpdates = maxUpdates;
+			m_Scheduler.SetMaxSteps(m_UpdateChannel, static_cast<uint32_t>(maxUpdates));
 		}
 	}
 
@@ -352,6 +491,8 @@ namespace Game
 
 	void Application::Initialize()
 	{
+		ProcessArgs(m_Specification.CommandLineArgs);
+
 		auto logLayer = MakePointer<LogLayer>();
 
 		Log::GetScriptLogger()->sinks().push_back(logLayer);
@@ -365,35 +506,50 @@ namespace Game
 		InitializeLua();
 		InitializeSettings();
 
-		m_Window = std::make_unique<Window>(
-		                                    WindowProperties{
-			                                    m_Specification.Name,
-			                                    m_Specification.WindowSize.X,
-			                                    m_Specification.WindowSize.Y
-		                                    }
-		                                   );
-		m_Window->SetEventCallback(BIND_EVENT_FN(Application::OnEvent));
+		FastClock::Calibrate();
 
-		LOG_INFO(
-		         "Created Window [Width: {}, Height: {}, Name: \"{}\", Fullscreen: {}]",
-		         m_Window->GetWidth(),
-		         m_Window->GetHeight(),
-		         m_Window->GetTitle(),
-		         m_Window->IsFullscreen()
-		        );
-		LOG_INFO("Max updates: {0}", m_MaxUpdates);
-		LOG_INFO("Update rate {0}", m_UpdateRate);
+		if(IsHeadless())
+			InitializeHeadless();
+		else
+		{
+			m_Window = std::make_unique<Window>(
+			                                    WindowProperties{
+				                                    m_Specification.Name,
+				                                    m_Specification.WindowSize.X,
+				                                    m_Specification.WindowSize.Y
+			                                    }
+			                                   );
+			m_Window->SetEventCallback(BIND_EVENT_FN(Application::OnEvent));
+
+			LOG_INFO(
+			         "Created Window [Width: {}, Height: {}, Name: \"{}\", Fullscreen: {}]",
+			         m_Window->GetWidth(),
+			         m_Window->GetHeight(),
+			         m_Window->GetTitle(),
+			         m_Window->IsFullscreen()
+			        );
+		}
 
-		LOG_INFO("Creating thread pool with {} threads", std::thread::hardware_concurrency());
-		// m_ThreadPool = MakeScope<ThreadPool>(std::thread::hardware_concurrency());
+		LOG_INFO("Max updates: {0}", GetMaxUpdates());
+		LOG_INFO("Update rate {0}", GetUpdateRate());
 
-		PushOverlay(m_ImGuiLayer = MakePointer<ImGuiLayer>());
-		PushOverlay(logLayer);
-		PushOverlay(MakePointer<StatisticLayer>());
-		PushOverlay(MakePointer<ConsoleLayer>());
-		// PushOverlay(MakePointer<ConfigLayer>());
+		m_ThreadPool = MakeScope<ThreadPool>();
+		TextureLoader::SetThreadPool(m_ThreadPool.get());
+		ImageIO::SetThreadPool(m_ThreadPool.get());
+		MipChain::SetThreadPool(m_ThreadPool.get());
 
-		auto OpenGL = m_Window->GetFunctions();
+		m_RenderTargets = MakeScope<RenderTargetPool>();
+
+		if(!IsHeadless())
+		{
+			PushOverlay(m_ImGuiLayer = MakePointer<ImGuiLayer>());
+			PushOverlay(logLayer);
+			PushOverlay(MakePointer<StatisticLayer>());
+			PushOverlay(MakePointer<ConsoleLayer>());
+			// PushOverlay(MakePointer<ConfigLayer>());
+		}
+
+		auto OpenGL = Context::GetContext()->GetFunctions();
 
 		// OpenGL.Enable(Capability::Blend);
 		// OpenGL.Enable(Capability::CullFace);
@@ -405,6 +561,11 @@ namespace Game
 
 		OpenGL.SetDebugMessageCallback(DebugCallback, nullptr);
 #endif
+
+		if(!m_Specification.ReplayInputPath.empty())
+			InputRecorder::StartReplay(m_Specification.ReplayInputPath, BIND_EVENT_FN(Application::OnEvent));
+		else if(!m_Specification.RecordInputPath.empty())
+			InputRecorder::StartRecording(m_Specification.RecordInputPath);
 	}
 
 #define ENUM_TO_STRING_ENUM(e, v) #v,  static_cast<int>(e::##v)
@@ -516,33 +677,184 @@ namespace Game
 		                            [this](uint64_t value) { this->SetMaxUpdates(value); }
 		                           );
 
+		// Without a window the specification stands in for it and changes are ignored
 		m_Properties->Add<uint32_t>(
 		                            "WindowWidth",
-		                            [this]() { return this->GetWindow().GetSize().Width; },
+		                            [this]() { return this->HasWindow() ? this->GetWindow().GetWidth() : this->m_Specification.WindowSize.X; },
 		                            [this](uint32_t value)
 		                            {
-			                            this->GetWindow().SetSize(value, this->GetWindow().GetHeight());
+			                            if(this->HasWindow())
+				                            this->GetWindow().SetSize(value, this->GetWindow().GetHeight());
 		                            }
 		                           );
 		m_Properties->Add<uint32_t>(
 		                            "WindowHeight",
-		                            [this]() { return this->GetWindow().GetWidth(); },
+		                            [this]() { return this->HasWindow() ? this->GetWindow().GetHeight() : this->m_Specification.WindowSize.Y; },
 		                            [this](uint32_t value)
 		                            {
-			                            this->GetWindow().SetSize(this->GetWindow().GetWidth(), value);
+			                            if(this->HasWindow())
+				                            this->GetWindow().SetSize(this->GetWindow().GetWidth(), value);
 		                            }
 		                           );
 
 		m_Properties->Add<bool>(
 		                        "FullscreenMode",
-		                        [this] { return this->GetWindow().IsFullscreen(); },
-		                        [this](bool value) { this->GetWindow().ToggleFullscreen(); }
+		                        [this] { return this->HasWindow() && this->GetWindow().IsFullscreen(); },
+		                        [this](bool value)
+		                        {
+			                        if(this->HasWindow() && this->GetWindow().IsFullscreen() != value)
+				                        this->GetWindow().ToggleFullscreen();
+		                        }
 		                       );
 		m_Properties->Add<std::string>(
 		                               "WindowName",
-		                               [this] { return std::string(this->GetWindow().GetTitle()); },
-		                               [this](std::string value) { this->GetWindow().SetTitle(value); }
+		                               [this] { return this->HasWindow() ? std::string(this->GetWindow().GetTitle()) : this->m_Specification.Name; },
+		                               [this](std::string value)
+		                               {
+			                               if(this->HasWindow())
+				                               this->GetWindow().SetTitle(value);
+		                               }
 		                              );
+
+		m_Properties->Add<float>(
+		                         "FrameRateLimit",
+		                         [this] { return this->m_FramePacer.GetTargetFrameRate(); },
+		                         [this](float value) { this->m_FramePacer.SetTargetFrameRate(value); }
+		                        );
+		m_Properties->Add<uint32_t>(
+		                            "MaxFramesInFlight",
+		                            [this] { return this->m_FramePacer.GetMaxFramesInFlight(); },
+		                            [this](uint32_t value) { this->m_FramePacer.SetMaxFramesInFlight(value); }
+		                           );
+		m_Properties->Add<bool>(
+		                        "VSync",
+		                        [this] { return this->HasWindow() && this->GetWindow().IsVSync(); },
+		                        [this](bool value)
+		                        {
+			                        if(this->HasWindow())
+				                        this->GetWindow().SetVSync(value);
+		                        }
+		                       );
+		m_Properties->Add<bool>(
+		                        "AdaptiveVSync",
+		                        [this] { return this->HasWindow() && this->GetWindow().IsAdaptiveVSync(); },
+		                        [this](bool value)
+		                        {
+			                        if(this->HasWindow())
+				                        this->GetWindow().SetAdaptiveVSync(value);
+		                        }
+		                       );
+	}
+
+	// EGL or OSMesa are not available through GLFW here, a hidden window provides the offscreen context instead
+	void Application::InitializeHeadless()
+	{
+		if(m_Specification.NullGL)
+		{
+			m_NullContext = Context::CreateNull();
+			GLBackend::Install(GLBackendType::Recording);
+		}
+		else
+		{
+			m_Window = MakeScope<Window>(
+			                             WindowProperties{
+				                             m_Specification.Name,
+				                             m_Specification.WindowSize.X,
+				                             m_Specification.WindowSize.Y,
+				                             false
+			                             }
+			                            );
+			m_Window->SetEventCallback(BIND_EVENT_FN(Application::OnEvent));
+			m_Window->SetVSync(false);
+		}
+
+		m_Offscreen = MakeScope<FrameBuffer<RenderBuffer, RenderBuffer>>(m_Specification.WindowSize);
+
+		LOG_INFO(
+		         "Running headless [Size: {}x{}, Backend: {}, Frames: {}]",
+		         m_Specification.WindowSize.Width,
+		         m_Specification.WindowSize.Height,
+		         m_Specification.NullGL ? "null" : "hidden window",
+		         m_Specification.Frames
+		        );
+	}
+
+	void Application::WriteReport(const std::vector<Time> &frameTimes) const
+	{
+		if(frameTimes.empty())
+		{
+			LOG_WARN("No frames were rendered");
+			return;
+		}
+
+		std::vector<int64_t> sorted;
+		sorted.reserve(frameTimes.size());
+
+		int64_t total = 0;
+		for(const auto &time : frameTimes)
+		{
+			sorted.emplace_back(time.AsNanoseconds());
+			total += time.AsNanoseconds();
+		}
+
+		std::ranges::sort(sorted);
+
+		const auto milliseconds = [](int64_t nanoseconds) { return static_cast<double>(nanoseconds) / 1000000.0; };
+		const auto percentile   = [&sorted](size_t percent) { return sorted[std::min(sorted.size() - 1, sorted.size() * percent / 100)]; };
+
+		const double mean = milliseconds(total) / static_cast<double>(sorted.size());
+		const uint64_t calls = GLBackend::GetType() == GLBackendType::Recording ? GLBackend::GetTotalCallCount() : 0;
+
+		LOG_INFO(
+		         "Rendered {} frames in {:.2f}s [Mean: {:.3f}ms, Min: {:.3f}ms, P50: {:.3f}ms, P95: {:.3f}ms, P99: {:.3f}ms, Max: {:.3f}ms]",
+		         sorted.size(),
+		         milliseconds(total) / 1000.0,
+		         mean,
+		         milliseconds(sorted.front()),
+		         milliseconds(percentile(50)),
+		         milliseconds(percentile(95)),
+		         milliseconds(percentile(99)),
+		         milliseconds(sorted.back())
+		        );
+
+		if(calls > 0)
+			LOG_INFO("GL calls: {} ({:.1f} per frame)", calls, static_cast<double>(calls) / static_cast<double>(sorted.size()));
+
+		if(m_Specification.ReportPath.empty())
+			return;
+
+		std::ofstream file(m_Specification.ReportPath, std::ios::trunc);
+
+		if(!file.is_open())
+		{
+			LOG_ERROR("Unable to write report: {}", m_Specification.ReportPath);
+			return;
+		}
+
+		file << fmt::format(
+		                    "{{\n"
+		                    "\t\"frames\": {},\n"
+		                    "\t\"total_ms\": {:.3f},\n"
+		                    "\t\"mean_ms\": {:.3f},\n"
+		                    "\t\"min_ms\": {:.3f},\n"
+		                    "\t\"p50_ms\": {:.3f},\n"
+		                    "\t\"p95_ms\": {:.3f},\n"
+		                    "\t\"p99_ms\": {:.3f},\n"
+		                    "\t\"max_ms\": {:.3f},\n"
+		                    "\t\"gl_calls\": {}\n"
+		                    "}}\n",
+		                    sorted.size(),
+		                    milliseconds(total),
+		                    mean,
+		                    milliseconds(sorted.front()),
+		                    milliseconds(percentile(50)),
+		                    milliseconds(percentile(95)),
+		                    milliseconds(percentile(99)),
+		                    milliseconds(sorted.back()),
+		                    calls
+		                   );
+
+		LOG_INFO("Report written to {}", m_Specification.ReportPath);
 	}
 
 	bool Application::OnWindowClose(WindowCloseEvent &event)
@@ -3,6 +3,8 @@
 #include "Engine/Core/Base.h"
 
 #include "Engine/Core/Clock.h"
+#include "Engine/Core/FixedStepScheduler.h"
+#include "Engine/Core/FramePacer.h"
 #include "Engine/Core/Window.h"
 
 #include "Engine/Layers/LayerStack.h"
@@ -14,7 +16,8 @@
 #include <vector>
 #include <stdexcept>
 
-// #include "ThreadPool.h"
+#include "Engine/Core/ThreadPool.h"
+#include "Engine/OpenGL/RenderTargetPool.h"
 
 int main(int argc, char** argv);
 
@@ -25,6 +28,10 @@ namespace Game
 	class LuaRegister;
 
 	class ImGuiLayer;
+	class RenderBuffer;
+
+	template <class ColorBufferType, class DepthBufferType>
+	class FrameBuffer;
 
 	struct ApplicationCommandLineArgs
 	{
@@ -51,6 +58,18 @@ namespace Game
 		bool Fullscreen = false;
 		Vector2u WindowSize { 800, 600 };
 
+		// Renders into an offscreen framebuffer of WindowSize, stops after Frames frames (0 runs until closed or an input replay ends) and reports frame times
+		bool Headless = false;
+		// Headless without a driver, GL calls go to the null backend and are counted
+		bool NullGL = false;
+
+		uint64_t Frames = 0;
+		std::string ReportPath;
+
+		// Input log of every fixed update tick, a replay stands in for live input, see InputRecorder
+		std::string RecordInputPath;
+		std::string ReplayInputPath;
+
 		ApplicationCommandLineArgs CommandLineArgs;
 	};
 
@@ -59,9 +78,16 @@ namespace Game
 		ApplicationSpecification m_Specification;
 
 		Scope<Window> m_Window;
+		Scope<Context> m_NullContext;
+		Scope<FrameBuffer<RenderBuffer, RenderBuffer>> m_Offscreen;
 		Scope<sol::state> m_Lua;
 		Scope<PropertyManager> m_Properties;
-		// Scope<ThreadPool> m_ThreadPool;
+		Scope<ThreadPool> m_ThreadPool;
+		Scope<RenderTargetPool> m_RenderTargets;
+
+		FramePacer m_FramePacer;
+		FixedStepScheduler m_Scheduler;
+		FixedStepScheduler::ChannelId m_UpdateChannel = 0;
 
 		bool m_Running     = true;
 		bool m_Minimalized = false;
@@ -72,9 +98,6 @@ namespace Game
 
 		int m_ExitCode = 0;
 
-		uint64_t m_MaxUpdates = 60;
-		uint32_t m_UpdateRate = static_cast<uint32_t>(1000.f / 60.f);
-
 		Time m_FrameTime  = Time::Zero;
 
 		Clock m_Clock;
@@ -94,8 +117,20 @@ namespace Game
 
 		void RegisterShortcut(const Shortcut& shortcut);
 
-		// ThreadPool& GetThreadPool() const { return *m_ThreadPool; }
-		Window& GetWindow() const { return *m_Window; }
+		ThreadPool& GetThreadPool() const { return *m_ThreadPool; }
+		RenderTargetPool& GetRenderTargetPool() const { return *m_RenderTargets; }
+		// Check HasWindow first, headless runs on the null device have none
+		Window& GetWindow() const
+		{
+			ASSERT(m_Window, "Application has no window");
+			if(!m_Window)
+				throw std::runtime_error("Application has no window");
+
+			return *m_Window;
+		}
+		bool HasWindow() const { return m_Window != nullptr; }
+
+		bool IsHeadless() const { return m_Specification.Headless; }
 
 		void Close() { Exit(0); }
 		void Exit(int exitCode);
@@ -106,15 +141,22 @@ namespace Game
 		virtual void ProcessArgs(const ApplicationCommandLineArgs &args);
 
 		void SetUpdateRate(float rate);
-		float GetUpdateRate() const { return 1000.f / static_cast<float>(m_UpdateRate); }
+		float GetUpdateRate() const { return m_Scheduler.GetRate(m_UpdateChannel); }
 
 		void SetMaxUpdates(uint64_t maxUpdates);
-		uint64_t GetMaxUpdates() const { return m_MaxUpdates; }
+		uint64_t GetMaxUpdates() const { return m_Scheduler.GetMaxSteps(m_UpdateChannel); }
+
+		// Layer updates run on the "Update" channel, further rates can be added next to it
+		FixedStepScheduler& GetScheduler() { return m_Scheduler; }
+		const FixedStepScheduler& GetScheduler() const { return m_Scheduler; }
+		FixedStepScheduler::ChannelId GetUpdateChannel() const { return m_UpdateChannel; }
 
 		Time GetElapsedTime() const { return m_Clock.GetElapsedTime(); }
 		Time GetFrameTime() const { return m_FrameTime; }
 
 		PropertyManager& GetProperties() const { return *m_Properties; }
+		FramePacer& GetFramePacer() { return m_FramePacer; }
+		const FramePacer& GetFramePacer() const { return m_FramePacer; }
 
 		void LuaRegister(LuaRegister &luaObject);
 
@@ -124,6 +166,9 @@ namespace Game
 		void InitializeLua();
 
 		void InitializeSettings();
+		void InitializeHeadless();
+
+		void WriteReport(const std::vector<Time> &frameTimes) const;
 		
 		bool OnWindowClose(WindowCloseEvent &event);
 		bool OnWindowResize(WindowResizeEvent &event);
@@ -1,50 +1,76 @@
 #include "pch.h"
 #include "Clock.h"
 
-#include <windows.h>
-#include <mutex>
+#include <thread>
+
+#if GAME_HAS_TSC && !defined(_MSC_VER)
+	#include <cpuid.h>
+#endif
 
 namespace
 {
-	LARGE_INTEGER GetFrequency()
-    {
-        LARGE_INTEGER frequency;
-        QueryPerformanceFrequency(&frequency);
-        return frequency;
-    }
+	constexpr auto CALIBRATION_TIME = std::chrono::milliseconds(20);
+
+	// Without an invariant counter the rate follows frequency scaling and the cores may disagree
+	bool HasInvariantTsc()
+	{
+#if GAME_HAS_TSC
+	#ifdef _MSC_VER
+		int registers[4];
+
+		__cpuid(registers, 0x80000000);
+		if(static_cast<uint32_t>(registers[0]) < 0x80000007)
+			return false;
+
+		__cpuid(registers, 0x80000007);
+		return (registers[3] & BIT(8)) != 0;
+	#else
+		unsigned int eax, ebx, ecx, edx;
+
+		if(!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx))
+			return false;
+
+		return (edx & BIT(8)) != 0;
+	#endif
+#else
+		return false;
+#endif
+	}
 }
 
 namespace Game
 {
-	namespace Priv
+	void FastClock::Calibrate()
 	{
-		class ClockImpl
+		s_Available = false;
+
+#if GAME_HAS_TSC
+		if(!HasInvariantTsc())
 		{
-		public:
-			static Time GetTime()
-			{
-				static LARGE_INTEGER frequency = GetFrequency();
+			LOG_INFO("CPU timestamp counter is not invariant, timing falls back to the system clock");
+			return;
+		}
 
-				LARGE_INTEGER time;
-				QueryPerformanceCounter(&time);
+		const Time start          = Clock::Now();
+		const uint64_t startTicks = __rdtsc();
 
-				return Microseconds(1000000 * time.QuadPart / frequency.QuadPart);
-			}
-		};
-	}
-	
-	Clock::Clock() : m_StartTime(Priv::ClockImpl::GetTime()) {}
-	Time Clock::GetElapsedTime() const
-	{
-		return Priv::ClockImpl::GetTime() - m_StartTime;
-	}
-	
-	Time Clock::Restart()
-	{
-		Time now = Priv::ClockImpl::GetTime() ;
-		const Time elapesed = now - m_StartTime;
-		m_StartTime = now;
+		std::this_thread::sleep_for(CALIBRATION_TIME);
+
+		const Time end          = Clock::Now();
+		const uint64_t endTicks = __rdtsc();
+
+		if(endTicks <= startTicks)
+		{
+			LOG_WARN("CPU timestamp counter did not advance, timing falls back to the system clock");
+			return;
+		}
+
+		s_NanosecondsPerTick = static_cast<double>((end - start).AsNanoseconds()) / static_cast<double>(endTicks - startTicks);
+		s_OriginTicks        = endTicks;
+		s_OriginTime         = end;
+		s_Available          = true;
 
-		return elapesed;
+		LOG_INFO("CPU timestamp counter runs at {:.3f} GHz", 1.0 / s_NanosecondsPerTick);
+#endif
 	}
 }
@@ -2,16 +2,66 @@
 
 #include "Engine/Core/Time.h"
 
+#include <chrono>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	#include <intrin.h>
+	#define GAME_HAS_TSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+	#define GAME_HAS_TSC 1
+#else
+	#define GAME_HAS_TSC 0
+#endif
+
 namespace Game
 {
 	class Clock
 	{
 		Time m_StartTime;
 	public:
-		
-		Clock();
 
-		Time GetElapsedTime() const;
-		Time Restart();
+		Clock() : m_StartTime(Now()) {}
+
+		Time GetElapsedTime() const { return Now() - m_StartTime; }
+
+		Time Restart()
+		{
+			const Time now     = Now();
+			const Time elapsed = now - m_StartTime;
+			m_StartTime        = now;
+
+			return elapsed;
+		}
+
+		// Monotonic, measured from an unspecified point shared by every Clock and FastClock
+		static Time Now()
+		{
+			return Nanoseconds(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+		}
+	};
+
+	// Reads the CPU timestamp counter, a handful of cycles instead of a call into the OS. Timestamps share the timebase of
+	// Clock::Now once calibrated, until then, or when the counter does not tick at a constant rate, Clock::Now is used
+	class FastClock
+	{
+		static inline bool s_Available            = false;
+		static inline double s_NanosecondsPerTick = 0.0;
+		static inline uint64_t s_OriginTicks      = 0;
+		static inline Time s_OriginTime;
+
+	public:
+		// Blocks for a few milliseconds while the counter is measured against Clock::Now
+		static void Calibrate();
+		static bool IsAvailable() { return s_Available; }
+
+		static Time Now()
+		{
+#if GAME_HAS_TSC
+			if(s_Available)
+				return s_OriginTime + Nanoseconds(static_cast<int64_t>(static_cast<double>(__rdtsc() - s_OriginTicks) * s_NanosecondsPerTick));
+#endif
+			return Clock::Now();
+		}
 	};
 }
@@ -0,0 +1,752 @@
+#include "pch.h"
+#include "CompressedImage.h"
+
+#include "Engine/Core/Assert.h"
+#include "Engine/Core/Image.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+namespace Game
+{
+	static constexpr uint32_t MakeFourCC(char a, char b, char c, char d)
+	{
+		return static_cast<uint32_t>(static_cast<uint8_t>(a)) |
+		       static_cast<uint32_t>(static_cast<uint8_t>(b)) << 8 |
+		       static_cast<uint32_t>(static_cast<uint8_t>(c)) << 16 |
+		       static_cast<uint32_t>(static_cast<uint8_t>(d)) << 24;
+	}
+
+	static constexpr uint32_t DDS_MAGIC = MakeFourCC('D', 'D', 'S', ' ');
+
+	static constexpr uint32_t DDSD_CAPS        = 0x1;
+	static constexpr uint32_t DDSD_HEIGHT      = 0x2;
+	static constexpr uint32_t DDSD_WIDTH       = 0x4;
+	static constexpr uint32_t DDSD_PIXELFORMAT = 0x1000;
+	static constexpr uint32_t DDSD_MIPMAPCOUNT = 0x20000;
+	static constexpr uint32_t DDSD_LINEARSIZE  = 0x80000;
+
+	static constexpr uint32_t DDPF_FOURCC = 0x4;
+
+	static constexpr uint32_t DDSCAPS_COMPLEX = 0x8;
+	static constexpr uint32_t DDSCAPS_TEXTURE = 0x1000;
+	static constexpr uint32_t DDSCAPS_MIPMAP  = 0x400000;
+
+	static constexpr uint32_t DDSCAPS2_CUBEMAP = 0x200;
+	static constexpr uint32_t DDSCAPS2_VOLUME  = 0x200000;
+
+	static constexpr uint32_t DDS_DIMENSION_TEXTURE2D = 3;
+	static constexpr uint32_t DDS_RESOURCE_MISC_CUBE  = 0x4;
+
+	static constexpr uint8_t KTX2_IDENTIFIER[12] = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+
+	struct DDSPixelFormat
+	{
+		uint32_t Size;
+		uint32_t Flags;
+		uint32_t FourCC;
+		uint32_t RGBBitCount;
+		uint32_t RBitMask;
+		uint32_t GBitMask;
+		uint32_t BBitMask;
+		uint32_t ABitMask;
+	};
+
+	struct DDSHeader
+	{
+		uint32_t Size;
+		uint32_t Flags;
+		uint32_t Height;
+		uint32_t Width;
+		uint32_t PitchOrLinearSize;
+		uint32_t Depth;
+		uint32_t MipMapCount;
+		uint32_t Reserved1[11];
+		DDSPixelFormat PixelFormat;
+		uint32_t Caps;
+		uint32_t Caps2;
+		uint32_t Caps3;
+		uint32_t Caps4;
+		uint32_t Reserved2;
+	};
+
+	struct DDSHeaderDX10
+	{
+		uint32_t DxgiFormat;
+		uint32_t ResourceDimension;
+		uint32_t MiscFlag;
+		uint32_t ArraySize;
+		uint32_t MiscFlags2;
+	};
+
+	struct KTX2Header
+	{
+		uint8_t Identifier[12];
+		uint32_t VkFormat;
+		uint32_t TypeSize;
+		uint32_t PixelWidth;
+		uint32_t PixelHeight;
+		uint32_t PixelDepth;
+		uint32_t LayerCount;
+		uint32_t FaceCount;
+		uint32_t LevelCount;
+		uint32_t SupercompressionScheme;
+		uint32_t DfdByteOffset;
+		uint32_t DfdByteLength;
+		uint32_t KvdByteOffset;
+		uint32_t KvdByteLength;
+		uint64_t SgdByteOffset;
+		uint64_t SgdByteLength;
+	};
+
+	struct KTX2Level
+	{
+		uint64_t ByteOffset;
+		uint64_t ByteLength;
+		uint64_t UncompressedByteLength;
+	};
+
+	static_assert(sizeof(DDSHeader) == 124);
+	static_assert(sizeof(DDSHeaderDX10) == 20);
+	static_assert(sizeof(KTX2Header) == 80);
+
+	template <typename T>
+	static T Read(const uint8_t *data, size_t size, size_t offset)
+	{
+		if(offset + sizeof(T) > size)
+			throw std::runtime_error("Unexpected end of file");
+
+		T value;
+		std::memcpy(&value, data + offset, sizeof(T));
+		return value;
+	}
+
+	static bool FromDxgi(uint32_t format, CompressedFormat &result, bool &srgb)
+	{
+		srgb = format == 72 || format == 75 || format == 78 || format == 99;
+
+		switch(format)
+		{
+			case 70:
+			case 71:
+			case 72: result = CompressedFormat::BC1;
+				return true;
+			case 73:
+			case 74:
+			case 75: result = CompressedFormat::BC2;
+				return true;
+			case 76:
+			case 77:
+			case 78: result = CompressedFormat::BC3;
+				return true;
+			case 79:
+			case 80: result = CompressedFormat::BC4;
+				return true;
+			case 82:
+			case 83: result = CompressedFormat::BC5;
+				return true;
+			case 97:
+			case 98:
+			case 99: result = CompressedFormat::BC7;
+				return true;
+			default:
+				return false;
+		}
+	}
+
+	static uint32_t ToDxgi(CompressedFormat format, bool srgb)
+	{
+		switch(format)
+		{
+			case CompressedFormat::BC1:
+				return srgb ? 72 : 71;
+			case CompressedFormat::BC2:
+				return srgb ? 75 : 74;
+			case CompressedFormat::BC3:
+				return srgb ? 78 : 77;
+			case CompressedFormat::BC4:
+				return 80;
+			case CompressedFormat::BC5:
+				return 83;
+			case CompressedFormat::BC7:
+				return srgb ? 99 : 98;
+			default:
+				return 0;
+		}
+	}
+
+	static bool FromVkFormat(uint32_t format, CompressedFormat &result, bool &srgb)
+	{
+		srgb = format == 132 || format == 134 || format == 136 || format == 138 || format == 146 || format == 148 ||
+		       format == 150 || format == 152;
+
+		switch(format)
+		{
+			case 131:
+			case 132:
+			case 133:
+			case 134: result = CompressedFormat::BC1;
+				return true;
+			case 135:
+			case 136: result = CompressedFormat::BC2;
+				return true;
+			case 137:
+			case 138: result = CompressedFormat::BC3;
+				return true;
+			case 139: result = CompressedFormat::BC4;
+				return true;
+			case 141: result = CompressedFormat::BC5;
+				return true;
+			case 145:
+			case 146: result = CompressedFormat::BC7;
+				return true;
+			case 147:
+			case 148: result = CompressedFormat::ETC2RGB;
+				return true;
+			case 151:
+			case 152: result = CompressedFormat::ETC2RGBA;
+				return true;
+			default:
+				return false;
+		}
+	}
+
+	static uint16_t To565(int32_t r, int32_t g, int32_t b)
+	{
+		return static_cast<uint16_t>(((r * 31 + 127) / 255) << 11 | ((g * 63 + 127) / 255) << 5 | (b * 31 + 127) / 255);
+	}
+
+	static void From565(uint16_t color, int32_t *rgb)
+	{
+		const int32_t r = (color >> 11) & 31;
+		const int32_t g = (color >> 5) & 63;
+		const int32_t b = color & 31;
+
+		rgb[0] = (r << 3) | (r >> 2);
+		rgb[1] = (g << 2) | (g >> 4);
+		rgb[2] = (b << 3) | (b >> 2);
+	}
+
+	static void FetchBlock(const Image &image, uint32_t x, uint32_t y, Color *block)
+	{
+		const auto pixels = image.GetPixels();
+
+		for(uint32_t j = 0; j < 4; ++j)
+		{
+			const uint32_t row = std::min(y + j, image.Height() - 1);
+
+			for(uint32_t i = 0; i < 4; ++i)
+			{
+				const uint32_t column = std::min(x + i, image.Width() - 1);
+				block[j * 4 + i]      = pixels[static_cast<size_t>(row) * image.Width() + column];
+			}
+		}
+	}
+
+	static void EncodeColorBlock(const Color *block, uint8_t *out, bool punchThrough)
+	{
+		int32_t min[3] = {255, 255, 255};
+		int32_t max[3] = {0, 0, 0};
+		int32_t mean[3] = {0, 0, 0};
+
+		int32_t opaque   = 0;
+		bool transparent = false;
+
+		for(uint32_t i = 0; i < 16; ++i)
+		{
+			if(punchThrough && block[i].A < 128)
+			{
+				transparent = true;
+				continue;
+			}
+
+			for(uint32_t c = 0; c < 3; ++c)
+			{
+				min[c] = std::min<int32_t>(min[c], block[i].Table[c]);
+				max[c] = std::max<int32_t>(max[c], block[i].Table[c]);
+				mean[c] += block[i].Table[c];
+			}
+
+			++opaque;
+		}
+
+		if(opaque == 0)
+		{
+			std::memset(out, 0, 4);
+			std::memset(out + 4, 0xFF, 4);
+			return;
+		}
+
+		// Pick the bounding box diagonal that follows the colour distribution
+		int32_t covariance[2] = {0, 0};
+		for(uint32_t i = 0; i < 16; ++i)
+		{
+			if(punchThrough && block[i].A < 128)
+				continue;
+
+			const int32_t r = block[i].R * opaque - mean[0];
+			covariance[0] += r * (block[i].G * opaque - mean[1]);
+			covariance[1] += r * (block[i].B * opaque - mean[2]);
+		}
+
+		if(covariance[0] < 0)
+			std::swap(min[1], max[1]);
+		if(covariance[1] < 0)
+			std::swap(min[2], max[2]);
+
+		for(uint32_t c = 0; c < 3; ++c)
+		{
+			const int32_t inset = (max[c] - min[c]) / 16;
+			max[c] -= inset;
+			min[c] += inset;
+		}
+
+		uint16_t color0 = To565(max[0], max[1], max[2]);
+		uint16_t color1 = To565(min[0], min[1], min[2]);
+
+		const bool threeColor = punchThrough && transparent;
+
+		if(threeColor ? color0 > color1 : color0 < color1)
+			std::swap(color0, color1);
+
+		int32_t palette[4][3];
+		From565(color0, palette[0]);
+		From565(color1, palette[1]);
+
+		const uint32_t count = threeColor ? 3 : (color0 == color1 ? 1 : 4);
+		for(uint32_t c = 0; c < 3; ++c)
+		{
+			if(threeColor)
+				palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+			else
+			{
+				palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+				palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+			}
+		}
+
+		uint32_t indices = 0;
+		for(uint32_t i = 0; i < 16; ++i)
+		{
+			uint32_t index = 0;
+
+			if(threeColor && block[i].A < 128)
+				index = 3;
+			else
+			{
+				int32_t best = std::numeric_limits<int32_t>::max();
+				for(uint32_t p = 0; p < count; ++p)
+				{
+					const int32_t dr = block[i].R - palette[p][0];
+					const int32_t dg = block[i].G - palette[p][1];
+					const int32_t db = block[i].B - palette[p][2];
+
+					const int32_t distance = dr * dr + dg * dg + db * db;
+					if(distance < best)
+					{
+						best  = distance;
+						index = p;
+					}
+				}
+			}
+
+			indices |= index << (i * 2);
+		}
+
+		out[0] = static_cast<uint8_t>(color0 & 0xFF);
+		out[1] = static_cast<uint8_t>(color0 >> 8);
+		out[2] = static_cast<uint8_t>(color1 & 0xFF);
+		out[3] = static_cast<uint8_t>(color1 >> 8);
+		std::memcpy(out + 4, &indices, 4);
+	}
+
+	static void EncodeChannelBlock(const Color *block, uint32_t channel, uint8_t *out)
+	{
+		int32_t min = 255;
+		int32_t max = 0;
+
+		for(uint32_t i = 0; i < 16; ++i)
+		{
+			min = std::min<int32_t>(min, block[i].Table[channel]);
+			max = std::max<int32_t>(max, block[i].Table[channel]);
+		}
+
+		out[0] = static_cast<uint8_t>(max);
+		out[1] = static_cast<uint8_t>(min);
+
+		int32_t palette[8] = {max, min};
+		for(int32_t i = 2; i < 8; ++i)
+			palette[i] = ((8 - i) * max + (i - 1) * min) / 7;
+
+		uint64_t indices = 0;
+		if(max != min)
+		{
+			for(uint32_t i = 0; i < 16; ++i)
+			{
+				uint64_t index = 0;
+				int32_t best   = std::numeric_limits<int32_t>::max();
+
+				for(uint32_t p = 0; p < 8; ++p)
+				{
+					const int32_t distance = std::abs(block[i].Table[channel] - palette[p]);
+					if(distance < best)
+					{
+						best  = distance;
+						index = p;
+					}
+				}
+
+				indices |= index << (i * 3);
+			}
+		}
+
+		for(uint32_t i = 0; i < 6; ++i)
+			out[2 + i] = static_cast<uint8_t>(indices >> (i * 8));
+	}
+
+	static void EncodeExplicitAlphaBlock(const Color *block, uint8_t *out)
+	{
+		uint64_t alpha = 0;
+		for(uint32_t i = 0; i < 16; ++i)
+			alpha |= static_cast<uint64_t>((block[i].A * 15 + 127) / 255) << (i * 4);
+
+		std::memcpy(out, &alpha, 8);
+	}
+
+	static void EncodeBlock(const Color *block, CompressedFormat format, uint8_t *out)
+	{
+		switch(format)
+		{
+			case CompressedFormat::BC1:
+				EncodeColorBlock(block, out, true);
+				break;
+			case CompressedFormat::BC2:
+				EncodeExplicitAlphaBlock(block, out);
+				EncodeColorBlock(block, out + 8, false);
+				break;
+			case CompressedFormat::BC3:
+				EncodeChannelBlock(block, 3, out);
+				EncodeColorBlock(block, out + 8, false);
+				break;
+			case CompressedFormat::BC4:
+				EncodeChannelBlock(block, 0, out);
+				break;
+			case CompressedFormat::BC5:
+				EncodeChannelBlock(block, 0, out);
+				EncodeChannelBlock(block, 1, out + 8);
+				break;
+			default:
+				break;
+		}
+	}
+
+	static Image Downsample(const Image &image)
+	{
+		const uint32_t width  = std::max(1u, image.Width() / 2);
+		const uint32_t height = std::max(1u, image.Height() / 2);
+
+		Image result(width, height);
+
+		for(uint32_t y = 0; y < height; ++y)
+		{
+			const uint32_t y0 = std::min(y * 2, image.Height() - 1);
+			const uint32_t y1 = std::min(y * 2 + 1, image.Height() - 1);
+
+			for(uint32_t x = 0; x < width; ++x)
+			{
+				const uint32_t x0 = std::min(x * 2, image.Width() - 1);
+				const uint32_t x1 = std::min(x * 2 + 1, image.Width() - 1);
+
+				const Color &a = image.GetPixel(x0, y0);
+				const Color &b = image.GetPixel(x1, y0);
+				const Color &c = image.GetPixel(x0, y1);
+				const Color &d = image.GetPixel(x1, y1);
+
+				Color &pixel = result.GetPixel(x, y);
+				for(uint32_t i = 0; i < Color::Size(); ++i)
+					pixel.Table[i] = static_cast<uint8_t>((a.Table[i] + b.Table[i] + c.Table[i] + d.Table[i] + 2) / 4);
+			}
+		}
+
+		return result;
+	}
+
+	CompressedImage::CompressedImage(CompressedFormat format, bool srgb) : m_Format(format),
+	                                                                     m_Srgb(srgb) {}
+
+	void CompressedImage::Clear()
+	{
+		m_Levels.clear();
+	}
+
+	void CompressedImage::Load(const std::string &fileName)
+	{
+		std::ifstream file;
+		file.exceptions(std::ios::failbit | std::ios::badbit);
+		file.open(fileName, std::ios::binary | std::ios::ate);
+
+		std::vector<uint8_t> data(static_cast<size_t>(file.tellg()));
+		file.seekg(0);
+		file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+
+		Load(data.data(), data.size());
+	}
+
+	void CompressedImage::Load(const uint8_t *data, size_t size)
+	{
+		if(size >= sizeof(KTX2_IDENTIFIER) && std::memcmp(data, KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER)) == 0)
+			return LoadKTX2(data, size);
+
+		if(size >= sizeof(uint32_t) && Read<uint32_t>(data, size, 0) == DDS_MAGIC)
+			return LoadDDS(data, size);
+
+		throw std::runtime_error("Unknown compressed image format");
+	}
+
+	void CompressedImage::LoadDDS(const uint8_t *data, size_t size)
+	{
+		Clear();
+
+		if(Read<uint32_t>(data, size, 0) != DDS_MAGIC)
+			throw std::runtime_error("Invalid DDS file");
+
+		const auto header = Read<DDSHeader>(data, size, sizeof(uint32_t));
+		size_t offset     = sizeof(uint32_t) + sizeof(DDSHeader);
+
+		if(header.Size != sizeof(DDSHeader) || !(header.PixelFormat.Flags & DDPF_FOURCC))
+			throw std::runtime_error("Unsupported DDS file");
+
+		if(header.Caps2 & (DDSCAPS2_CUBEMAP | DDSCAPS2_VOLUME))
+			throw std::runtime_error("Only 2D DDS textures are supported");
+
+		m_Srgb = false;
+
+		switch(header.PixelFormat.FourCC)
+		{
+			case MakeFourCC('D', 'X', 'T', '1'):
+				m_Format = CompressedFormat::BC1;
+				break;
+			case MakeFourCC('D', 'X', 'T', '2'):
+			case MakeFourCC('D', 'X', 'T', '3'):
+				m_Format = CompressedFormat::BC2;
+				break;
+			case MakeFourCC('D', 'X', 'T', '4'):
+			case MakeFourCC('D', 'X', 'T', '5'):
+				m_Format = CompressedFormat::BC3;
+				break;
+			case MakeFourCC('A', 'T', 'I', '1'):
+			case MakeFourCC('B', 'C', '4', 'U'):
+				m_Format = CompressedFormat::BC4;
+				break;
+			case MakeFourCC('A', 'T', 'I', '2'):
+			case MakeFourCC('B', 'C', '5', 'U'):
+				m_Format = CompressedFormat::BC5;
+				break;
+			case MakeFourCC('D', 'X', '1', '0'):
+			{
+				const auto dx10 = Read<DDSHeaderDX10>(data, size, offset);
+				offset += sizeof(DDSHeaderDX10);
+
+				if(dx10.ResourceDimension != DDS_DIMENSION_TEXTURE2D || (dx10.MiscFlag & DDS_RESOURCE_MISC_CUBE) || dx10.ArraySize > 1)
+					throw std::runtime_error("Only 2D DDS textures are supported");
+
+				if(!FromDxgi(dx10.DxgiFormat, m_Format, m_Srgb))
+					throw std::runtime_error(fmt::format("Unsupported DXGI format: {}", dx10.DxgiFormat));
+				break;
+			}
+			default:
+				throw std::runtime_error("Unsupported DDS pixel format");
+		}
+
+		const uint32_t levels = (header.Flags & DDSD_MIPMAPCOUNT) ? std::max(1u, header.MipMapCount) : 1;
+		Vector2u levelSize{header.Width, header.Height};
+
+		for(uint32_t level = 0; level < levels; ++level)
+		{
+			const size_t levelBytes = LevelSize(m_Format, levelSize);
+			if(offset + levelBytes > size)
+				throw std::runtime_error("Unexpected end of file");
+
+			AddLevel(levelSize, std::vector<uint8_t>(data + offset, data + offset + levelBytes));
+			offset += levelBytes;
+
+			levelSize = {std::max(1u, levelSize.Width / 2), std::max(1u, levelSize.Height / 2)};
+		}
+	}
+
+	void CompressedImage::LoadKTX2(const uint8_t *data, size_t size)
+	{
+		Clear();
+
+		const auto header = Read<KTX2Header>(data, size, 0);
+
+		if(std::memcmp(header.Identifier, KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER)) != 0)
+			throw std::runtime_error("Invalid KTX2 file");
+
+		if(header.SupercompressionScheme != 0)
+			throw std::runtime_error("Supercompressed KTX2 files are not supported");
+
+		if(header.PixelDepth > 1 || header.LayerCount > 1 || header.FaceCount != 1)
+			throw std::runtime_error("Only 2D KTX2 textures are supported");
+
+		if(!FromVkFormat(header.VkFormat, m_Format, m_Srgb))
+			throw std::runtime_error(fmt::format("Unsupported KTX2 format: {}", header.VkFormat));
+
+		const uint32_t levels = std::max(1u, header.LevelCount);
+		Vector2u levelSize{header.PixelWidth, header.PixelHeight};
+
+		for(uint32_t level = 0; level < levels; ++level)
+		{
+			const auto index = Read<KTX2Level>(data, size, sizeof(KTX2Header) + level * sizeof(KTX2Level));
+
+			// Both come from the file, their sum may wrap around
+			if(index.ByteOffset > size || index.ByteLength > size - index.ByteOffset || index.ByteLength < LevelSize(m_Format, levelSize))
+				throw std::runtime_error("Invalid KTX2 level");
+
+			const auto begin = data + index.ByteOffset;
+			AddLevel(levelSize, std::vector<uint8_t>(begin, begin + LevelSize(m_Format, levelSize)));
+
+			levelSize = {std::max(1u, levelSize.Width / 2), std::max(1u, levelSize.Height / 2)};
+		}
+	}
+
+	void CompressedImage::SaveDDS(const std::string &fileName) const
+	{
+		ASSERT(!Empty(), "Empty image");
+		if(Empty())
+			throw std::runtime_error("Empty image");
+
+		const uint32_t dxgi = ToDxgi(m_Format, m_Srgb);
+		if(dxgi == 0)
+			throw std::runtime_error("Format can not be stored in DDS file");
+
+		DDSHeader header{};
+		header.Size              = sizeof(DDSHeader);
+		header.Flags             = DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_MIPMAPCOUNT | DDSD_LINEARSIZE;
+		header.Width             = Width();
+		header.Height            = Height();
+		header.PitchOrLinearSize = static_cast<uint32_t>(m_Levels.front().Data.size());
+		header.MipMapCount       = Levels();
+
+		header.PixelFormat.Size   = sizeof(DDSPixelFormat);
+		header.PixelFormat.Flags  = DDPF_FOURCC;
+		header.PixelFormat.FourCC = MakeFourCC('D', 'X', '1', '0');
+
+		header.Caps = DDSCAPS_TEXTURE | (Levels() > 1 ? DDSCAPS_COMPLEX | DDSCAPS_MIPMAP : 0);
+
+		DDSHeaderDX10 dx10{};
+		dx10.DxgiFormat        = dxgi;
+		dx10.ResourceDimension = DDS_DIMENSION_TEXTURE2D;
+		dx10.ArraySize         = 1;
+
+		std::ofstream file;
+		file.exceptions(std::ios::failbit | std::ios::badbit);
+		file.open(fileName, std::ios::binary);
+
+		file.write(reinterpret_cast<const char*>(&DDS_MAGIC), sizeof(DDS_MAGIC));
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		file.write(reinterpret_cast<const char*>(&dx10), sizeof(dx10));
+
+		for(const auto &level : m_Levels)
+			file.write(reinterpret_cast<const char*>(level.Data.data()), static_cast<std::streamsize>(level.Data.size()));
+	}
+
+	CompressedImage CompressedImage::Encode(const Image &image, CompressedFormat format, bool mipMaps, bool srgb)
+	{
+		ASSERT(CanEncode(format), "Unsupported encoder format");
+		if(!CanEncode(format))
+			throw std::invalid_argument("Unsupported encoder format");
+
+		ASSERT(image.Width() > 0 && image.Height() > 0, "Empty image");
+		if(image.Width() == 0 || image.Height() == 0)
+			throw std::invalid_argument("Empty image");
+
+		CompressedImage result(format, srgb);
+
+		const uint32_t blockSize = BlockSize(format);
+
+		Image mip;
+		const Image *source = &image;
+
+		while(true)
+		{
+			const uint32_t blocksX = (source->Width() + 3) / 4;
+			const uint32_t blocksY = (source->Height() + 3) / 4;
+
+			std::vector<uint8_t> data(static_cast<size_t>(blocksX) * blocksY * blockSize);
+			Color block[16];
+
+			for(uint32_t y = 0; y < blocksY; ++y)
+			{
+				for(uint32_t x = 0; x < blocksX; ++x)
+				{
+					FetchBlock(*source, x * 4, y * 4, block);
+					EncodeBlock(block, format, data.data() + (static_cast<size_t>(y) * blocksX + x) * blockSize);
+				}
+			}
+
+			result.AddLevel(source->Size(), std::move(data));
+
+			if(!mipMaps || (source->Width() == 1 && source->Height() == 1))
+				break;
+
+			mip    = Downsample(*source);
+			source = &mip;
+		}
+
+		return result;
+	}
+
+	bool CompressedImage::CanEncode(CompressedFormat format)
+	{
+		return format == CompressedFormat::BC1 || format == CompressedFormat::BC2 || format == CompressedFormat::BC3 ||
+		       format == CompressedFormat::BC4 || format == CompressedFormat::BC5;
+	}
+
+	uint32_t CompressedImage::BlockSize(CompressedFormat format)
+	{
+		switch(format)
+		{
+			case CompressedFormat::BC1:
+			case CompressedFormat::BC4:
+			case CompressedFormat::ETC2RGB:
+				return 8;
+			default:
+				return 16;
+		}
+	}
+
+	size_t CompressedImage::LevelSize(CompressedFormat format, const Vector2u &size)
+	{
+		return static_cast<size_t>((size.Width + 3) / 4) * ((size.Height + 3) / 4) * BlockSize(format);
+	}
+
+	const CompressedImage::Level& CompressedImage::GetLevel(uint32_t level) const
+	{
+		ASSERT(level < m_Levels.size(), "Out of range");
+		if(level >= m_Levels.size())
+			throw std::out_of_range("Out of range");
+
+		return m_Levels[level];
+	}
+
+	size_t CompressedImage::DataSize() const
+	{
+		size_t size = 0;
+		for(const auto &level : m_Levels)
+			size += level.Data.size();
+
+		return size;
+	}
+
+	void CompressedImage::AddLevel(const Vector2u &size, std::vector<uint8_t> data)
+	{
+		ASSERT(data.size() == LevelSize(m_Format, size), "Invalid level size");
+		if(data.size() != LevelSize(m_Format, size))
+			throw std::invalid_argument("Invalid level size");
+
+		m_Levels.push_back(Level{size, std::move(data)});
+	}
+}
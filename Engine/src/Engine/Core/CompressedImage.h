@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/Core/Vector2.h"
+
+#include <string>
+#include <vector>
+
+namespace Game
+{
+	class Image;
+
+	enum class CompressedFormat
+	{
+		BC1,
+		BC2,
+		BC3,
+		BC4,
+		BC5,
+		BC7,
+		ETC2RGB,
+		ETC2RGBA
+	};
+
+	class CompressedImage
+	{
+	public:
+		struct Level
+		{
+			Vector2u Size;
+			std::vector<uint8_t> Data;
+		};
+
+	private:
+		CompressedFormat m_Format = CompressedFormat::BC1;
+		bool m_Srgb               = false;
+
+		std::vector<Level> m_Levels;
+
+	public:
+		CompressedImage() = default;
+		CompressedImage(CompressedFormat format, bool srgb = false);
+
+		void Clear();
+
+		void Load(const std::string &fileName);
+		void Load(const uint8_t *data, size_t size);
+
+		void LoadDDS(const uint8_t *data, size_t size);
+		void LoadKTX2(const uint8_t *data, size_t size);
+
+		void SaveDDS(const std::string &fileName) const;
+
+		static CompressedImage Encode(const Image &image, CompressedFormat format, bool mipMaps = true, bool srgb = false);
+		static bool CanEncode(CompressedFormat format);
+
+		static uint32_t BlockSize(CompressedFormat format);
+		static size_t LevelSize(CompressedFormat format, const Vector2u &size);
+
+		CompressedFormat Format() const { return m_Format; }
+		bool IsSrgb() const { return m_Srgb; }
+		bool HasAlpha() const { return m_Format != CompressedFormat::BC4 && m_Format != CompressedFormat::BC5 && m_Format != CompressedFormat::ETC2RGB; }
+
+		bool Empty() const { return m_Levels.empty(); }
+
+		uint32_t Levels() const { return static_cast<uint32_t>(m_Levels.size()); }
+		const Level& GetLevel(uint32_t level) const;
+
+		Vector2u Size() const { return m_Levels.empty() ? Vector2u{} : m_Levels.front().Size; }
+		uint32_t Width() const { return Size().Width; }
+		uint32_t Height() const { return Size().Height; }
+
+		size_t DataSize() const;
+
+		void AddLevel(const Vector2u &size, std::vector<uint8_t> data);
+	};
+}
@@ -0,0 +1,127 @@
+#include "pch.h"
+#include "Engine/Core/FixedStepScheduler.h"
+
+namespace Game
+{
+	FixedStepScheduler::ChannelId FixedStepScheduler::Add(std::string_view name, float rate, Callback callback, uint32_t maxSteps)
+	{
+		ASSERT(callback, "Fixed step channel requires a callback");
+		if(!callback)
+			throw std::invalid_argument("Fixed step channel requires a callback");
+
+		auto &channel = m_Channels.emplace_back();
+
+		channel.Name         = name;
+		channel.Function     = std::move(callback);
+		channel.Step         = ToStep(rate);
+		channel.Accumulator  = Time::Zero;
+		channel.MaxSteps     = std::max<uint32_t>(maxSteps, 1);
+		channel.Ticks        = 0;
+		channel.DroppedSteps = 0;
+		channel.Dropped      = Time::Zero;
+
+		return static_cast<ChannelId>(m_Channels.size() - 1);
+	}
+
+	// Ids stay valid, the channel only stops running
+	void FixedStepScheduler::Remove(ChannelId channel)
+	{
+		Get(channel).Function = nullptr;
+	}
+
+	void FixedStepScheduler::Advance(const Time &elapsed)
+	{
+		// Callbacks may add channels, indices survive the reallocation references would not
+		for(size_t i = 0; i < m_Channels.size(); ++i)
+		{
+			if(!m_Channels[i].Function)
+				continue;
+
+			m_Channels[i].Accumulator += elapsed;
+
+			for(uint32_t steps = 0; steps < m_Channels[i].MaxSteps && m_Channels[i].Accumulator >= m_Channels[i].Step; ++steps)
+			{
+				const Time step = m_Channels[i].Step;
+
+				m_Channels[i].Accumulator -= step;
+				++m_Channels[i].Ticks;
+
+				m_Channels[i].Function(step);
+
+				if(!m_Channels[i].Function)
+					break;
+			}
+
+			auto &channel = m_Channels[i];
+
+			if(channel.Accumulator >= channel.Step)
+			{
+				const Time excess = channel.Accumulator - channel.Accumulator % channel.Step;
+				const auto steps  = static_cast<uint64_t>(excess / channel.Step + 0.5f);
+
+				LOG_TRACE("{} fell behind, dropping {} steps", channel.Name, steps);
+
+				channel.Accumulator -= excess;
+				channel.Dropped += excess;
+				channel.DroppedSteps += steps;
+			}
+		}
+	}
+
+	void FixedStepScheduler::Reset()
+	{
+		for(auto &channel : m_Channels)
+			channel.Accumulator = Time::Zero;
+	}
+
+	void FixedStepScheduler::SetRate(ChannelId channel, float rate)
+	{
+		auto &target = Get(channel);
+
+		target.Step        = ToStep(rate);
+		target.Accumulator = std::min(target.Accumulator, target.Step);
+	}
+
+	float FixedStepScheduler::GetRate(ChannelId channel) const
+	{
+		return 1.f / Get(channel).Step.AsSeconds();
+	}
+
+	void FixedStepScheduler::SetMaxSteps(ChannelId channel, uint32_t steps)
+	{
+		Get(channel).MaxSteps = std::max<uint32_t>(steps, 1);
+	}
+
+	float FixedStepScheduler::GetAlpha(ChannelId channel) const
+	{
+		const auto &target = Get(channel);
+		return std::clamp(target.Accumulator / target.Step, 0.f, 1.f);
+	}
+
+	Time FixedStepScheduler::ToStep(float rate)
+	{
+		ASSERT(rate > 0.f, "Fixed step rate has to be positive");
+		if(rate <= 0.f)
+			throw std::invalid_argument("Fixed step rate has to be positive");
+
+		return Nanoseconds(std::max<int64_t>(static_cast<int64_t>(1000000000.0 / rate + 0.5), 1));
+	}
+
+	FixedStepScheduler::Channel& FixedStepScheduler::Get(ChannelId channel)
+	{
+		ASSERT(channel < m_Channels.size(), "Unknown fixed step channel");
+		if(channel >= m_Channels.size())
+			throw std::out_of_range("Unknown fixed step channel");
+
+		return m_Channels[channel];
+	}
+
+	const FixedStepScheduler::Channel& FixedStepScheduler::Get(ChannelId channel) const
+	{
+		ASSERT(channel < m_Channels.size(), "Unknown fixed step channel");
+		if(channel >= m_Channels.size())
+			throw std::out_of_range("Unknown fixed step channel");
+
+		return m_Channels[channel];
+	}
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/Core/Time.h"
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Game
+{
+	// Runs any number of independent fixed rate channels (simulation, physics, AI, networking...) from the variable frame
+	// time. Every channel accumulates elapsed time and steps while a whole step is due, at most MaxSteps times per
+	// Advance, time beyond that is dropped and counted instead of being caught up later
+	class FixedStepScheduler
+	{
+	public:
+		using Callback = std::function<void(const Time&)>;
+		using ChannelId = uint32_t;
+
+	private:
+		struct Channel
+		{
+			std::string Name;
+			Callback Function;
+
+			Time Step;
+			Time Accumulator;
+			uint32_t MaxSteps;
+
+			uint64_t Ticks;
+			uint64_t DroppedSteps;
+			Time Dropped;
+		};
+
+		std::vector<Channel> m_Channels;
+
+	public:
+		ChannelId Add(std::string_view name, float rate, Callback callback, uint32_t maxSteps = 5);
+		void Remove(ChannelId channel);
+
+		// Steps every channel by the time that passed since the last call
+		void Advance(const Time &elapsed);
+
+		// Drops accumulated time, e.g. after loading or a long pause
+		void Reset();
+
+		void SetRate(ChannelId channel, float rate);
+		float GetRate(ChannelId channel) const;
+		Time GetStep(ChannelId channel) const { return Get(channel).Step; }
+
+		void SetMaxSteps(ChannelId channel, uint32_t steps);
+		uint32_t GetMaxSteps(ChannelId channel) const { return Get(channel).MaxSteps; }
+
+		// How far into the next step the channel is, in [0, 1), for interpolating between the last two states
+		float GetAlpha(ChannelId channel) const;
+
+		uint64_t GetTicks(ChannelId channel) const { return Get(channel).Ticks; }
+		uint64_t GetDroppedSteps(ChannelId channel) const { return Get(channel).DroppedSteps; }
+		Time GetDroppedTime(ChannelId channel) const { return Get(channel).Dropped; }
+
+		std::string_view GetName(ChannelId channel) const { return Get(channel).Name; }
+
+	private:
+		static Time ToStep(float rate);
+
+		Channel& Get(ChannelId channel);
+		const Channel& Get(ChannelId channel) const;
+	};
+}
@@ -0,0 +1,134 @@
+#include "pch.h"
+#include "Engine/Core/FramePacer.h"
+
+#include "Engine/Renderer/Context.h"
+
+#include <thread>
+
+#if defined(_WIN32)
+	#include <timeapi.h>
+#endif
+
+namespace
+{
+	constexpr uint64_t FENCE_TIMEOUT = 1000000000;
+
+	constexpr double SLEEP_SMOOTHING  = 0.1;
+	constexpr double SLEEP_DEVIATIONS = 2.0;
+
+	// The default scheduler tick on Windows is 15.6ms, a 1ms sleep would overshoot every frame budget above 64Hz
+	class TimerResolutionGuard
+	{
+#if defined(_WIN32)
+		bool m_Raised = false;
+	public:
+		TimerResolutionGuard() : m_Raised(timeBeginPeriod(1) == TIMERR_NOERROR) {}
+
+		~TimerResolutionGuard()
+		{
+			if(m_Raised)
+				timeEndPeriod(1);
+		}
+#endif
+	};
+}
+
+namespace Game
+{
+	void FramePacer::SetTargetFrameRate(float rate)
+	{
+		m_TargetRate = std::max(rate, 0.f);
+		m_Interval   = m_TargetRate > 0.f ? Nanoseconds(static_cast<int64_t>(1000000000.0 / m_TargetRate)) : Time::Zero;
+		m_Deadline   = m_Clock.GetElapsedTime();
+	}
+
+	void FramePacer::SetMaxFramesInFlight(uint32_t frames)
+	{
+		m_FramesInFlight = std::clamp<uint32_t>(frames, 1, MAX_FRAMES_IN_FLIGHT);
+	}
+
+	void FramePacer::Wait()
+	{
+		const Time start = m_Clock.GetElapsedTime();
+
+		WaitForGpu();
+
+		const Time ready = m_Clock.GetElapsedTime();
+		m_FenceWaitTime  = ready - start;
+
+		if(m_Interval > Time::Zero)
+		{
+			m_Deadline += m_Interval;
+
+			// A frame that ran over starts a new schedule instead of rushing the following ones
+			if(m_Deadline < ready)
+				m_Deadline = ready;
+			else
+				WaitUntil(m_Deadline);
+		}
+
+		m_WaitTime = m_Clock.GetElapsedTime() - ready;
+	}
+
+	void FramePacer::EndFrame()
+	{
+		if(Context::GetContext())
+			m_Fences[m_Frame % MAX_FRAMES_IN_FLIGHT] = Fence::Insert();
+
+		++m_Frame;
+	}
+
+	void FramePacer::Reset()
+	{
+		for(auto &fence : m_Fences)
+			fence.Reset();
+
+		m_Frame    = 0;
+		m_Deadline = m_Clock.GetElapsedTime();
+	}
+
+	void FramePacer::WaitForGpu()
+	{
+		if(m_Frame < m_FramesInFlight || !Context::GetContext())
+			return;
+
+		auto &fence = m_Fences[(m_Frame - m_FramesInFlight) % MAX_FRAMES_IN_FLIGHT];
+
+		if(fence && !fence.Wait(FENCE_TIMEOUT))
+			GL_LOG_WARN("GPU did not finish frame {} within a second", m_Frame - m_FramesInFlight);
+
+		fence.Reset();
+	}
+
+	void FramePacer::WaitUntil(Time deadline)
+	{
+		const Time expected = Microseconds(static_cast<int64_t>(m_SleepMean + SLEEP_DEVIATIONS * std::sqrt(m_SleepVariance)));
+
+		if(deadline - m_Clock.GetElapsedTime() > expected)
+		{
+			TimerResolutionGuard resolution;
+
+			while(true)
+			{
+				const Time now = m_Clock.GetElapsedTime();
+
+				if(deadline - now <= expected)
+					break;
+
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				AddSleepSample(m_Clock.GetElapsedTime() - now);
+			}
+		}
+
+		while(m_Clock.GetElapsedTime() < deadline)
+			std::this_thread::yield();
+	}
+
+	void FramePacer::AddSleepSample(Time slept)
+	{
+		const double delta = static_cast<double>(slept.AsMicroseconds()) - m_SleepMean;
+
+		m_SleepMean += SLEEP_SMOOTHING * delta;
+		m_SleepVariance = (1.0 - SLEEP_SMOOTHING) * (m_SleepVariance + SLEEP_SMOOTHING * delta * delta);
+	}
+}
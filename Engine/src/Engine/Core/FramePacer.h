@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/Core/Clock.h"
+#include "Engine/OpenGL/Fence.h"
+
+#include <array>
+
+namespace Game
+{
+	// Caps the frame rate and the number of frames the GPU may queue. Waiting sleeps while the remaining time is above
+	// what a sleep is expected to overshoot by and spins for the rest, so deadlines are hit without burning a core
+	class FramePacer
+	{
+	public:
+		static constexpr uint32_t MAX_FRAMES_IN_FLIGHT = 4;
+
+	private:
+		std::array<Fence, MAX_FRAMES_IN_FLIGHT> m_Fences;
+		uint64_t m_Frame = 0;
+		uint32_t m_FramesInFlight = 2;
+
+		float m_TargetRate = 0.f;
+		Time m_Interval    = Time::Zero;
+		Time m_Deadline    = Time::Zero;
+
+		// Moving mean and variance of how long a 1ms sleep actually takes, in microseconds
+		double m_SleepMean     = 1000.0;
+		double m_SleepVariance = 0.0;
+
+		Time m_WaitTime      = Time::Zero;
+		Time m_FenceWaitTime = Time::Zero;
+
+		Clock m_Clock;
+
+	public:
+		FramePacer() = default;
+
+		FramePacer(const FramePacer&) = delete;
+		FramePacer& operator=(const FramePacer&) = delete;
+
+		// Frames per second, 0 leaves the rate to VSync
+		void SetTargetFrameRate(float rate);
+		float GetTargetFrameRate() const { return m_TargetRate; }
+
+		// 1 waits for the GPU to finish the previous frame before the next one starts, the lowest latency
+		void SetMaxFramesInFlight(uint32_t frames);
+		uint32_t GetMaxFramesInFlight() const { return m_FramesInFlight; }
+
+		// Call before polling input, blocks until the GPU is within the frame budget and the next deadline is reached
+		void Wait();
+
+		// Call right after the swap
+		void EndFrame();
+
+		// Drops every fence, needed before the context goes away
+		void Reset();
+
+		// Time the last Wait slept and spun for the deadline and blocked on the GPU
+		Time GetWaitTime() const { return m_WaitTime; }
+		Time GetFenceWaitTime() const { return m_FenceWaitTime; }
+
+	private:
+		void WaitForGpu();
+		void WaitUntil(Time deadline);
+		void AddSleepSample(Time slept);
+	};
+}
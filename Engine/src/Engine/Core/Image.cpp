@@ -5,6 +5,8 @@
 #include <FreeImage.h>
 
 #include "Assert.h"
+#include "PixelConversion.h"
+#include "PixelPool.h"
 
 namespace Game
 {
@@ -44,58 +46,32 @@ namespace Game
 		Create(width, height, background);
 	}
 
-	Image::Image(uint32_t width, uint32_t height, const Color *pixels) : m_Width(width),
-	                                                                     m_Height(height)
+	Image::Image(uint32_t width, uint32_t height, const Color *pixels)
 	{
-		m_Pixels = new Color[static_cast<size_t>(width) * height];
+		Resize(width, height);
 		std::memcpy(m_Pixels, pixels, static_cast<size_t>(width) * height * sizeof(Color));
 	}
 
-	Image::Image(uint32_t width, uint32_t height, const uint8_t *pixels) : m_Width(width),
-	                                                                       m_Height(height)
+	Image::Image(uint32_t width, uint32_t height, const uint8_t *pixels)
 	{
-		m_Pixels = new Color[static_cast<size_t>(width) * height];
-
+		Resize(width, height);
 		std::memcpy(m_Pixels, pixels, static_cast<size_t>(width) * height * sizeof(Color));
 	}
 
-	Image::Image(uint32_t width, uint32_t height, const glm::vec4 *pixels) : m_Width(width),
-	                                                                         m_Height(height)
+	Image::Image(uint32_t width, uint32_t height, const glm::vec4 *pixels) : Image(width, height, reinterpret_cast<const float*>(pixels))
 	{
-		m_Pixels = new Color[static_cast<size_t>(width) * height];
-
-		ASSERT(pixels)
-		if(pixels)
-			return;
-
-		for(uint32_t i = 0; i < width; ++i)
-			for(uint32_t j = 0; j < height; ++j)
-			{
-				const auto &pixel       = pixels[i + j * width];
-				m_Pixels[i + j * width] = Color(pixel);
-			}
+		static_assert(sizeof(glm::vec4) == 4 * sizeof(float));
 	}
 
-	Image::Image(uint32_t width, uint32_t height, const float *pixels) : m_Width(width),
-	                                                                     m_Height(height)
+	Image::Image(uint32_t width, uint32_t height, const float *pixels)
 	{
-		m_Pixels = new Color[static_cast<size_t>(width) * height];
+		Resize(width, height);
 
 		ASSERT(pixels)
-		if(pixels)
+		if(!pixels)
 			return;
 
-		for(uint32_t i = 0; i < width; ++i)
-			for(uint32_t j = 0; j < height; ++j)
-			{
-				const size_t colorIndex = (i + j * width) * 4;
-				m_Pixels[i + j * width] = Color(
-				                                pixels[colorIndex + 0],
-				                                pixels[colorIndex + 1],
-				                                pixels[colorIndex + 2],
-				                                pixels[colorIndex + 3]
-				                               );
-			}
+		PixelConversion::FloatToUnorm8(pixels, reinterpret_cast<uint8_t*>(m_Pixels), static_cast<size_t>(width) * height * Color::Size());
 	}
 
 	Image::Image(const Vector2u &size, const Color &background) : Image(size.Width, size.Height, background) {}
@@ -104,6 +80,12 @@ namespace Game
 	Image::Image(const Vector2u &size, const glm::vec4 *pixels) : Image(size.Width, size.Height, pixels) {}
 	Image::Image(const Vector2u &size, const float *pixels) : Image(size.Width, size.Height, pixels) {}
 
+	Image::Image(const ConstImageView &view)
+	{
+		Resize(view.Width(), view.Height());
+		View().CopyFrom(view);
+	}
+
 	Image::Image(const Image &image)
 	{
 		*this = image;
@@ -121,44 +103,53 @@ namespace Game
 
 	void Image::Create(uint32_t width, uint32_t height, const Color &background)
 	{
-		Clear();
+		Resize(width, height);
+		std::fill_n(m_Pixels, static_cast<size_t>(width) * height, background);
+	}
 
-		m_Width  = width;
-		m_Height = height;
+	void Image::Resize(uint32_t width, uint32_t height)
+	{
+		const size_t size = static_cast<size_t>(width) * height * sizeof(Color);
 
-		const size_t size = static_cast<size_t>(width) * height;
+		if(size > m_Capacity)
+		{
+			Clear();
 
-		m_Pixels = new Color[size];
+			m_Pixels   = static_cast<Color*>(PixelPool::Allocate(size));
+			m_Capacity = PixelPool::GetCapacity(size);
+		}
 
-		std::fill_n(m_Pixels, size, background);
+		m_Width  = width;
+		m_Height = height;
 	}
 
 	void Image::Clear()
 	{
-		delete[] m_Pixels;
+		PixelPool::Free(m_Pixels, m_Capacity);
 
-		m_Pixels = nullptr;
-		m_Width  = m_Height = 0;
+		m_Pixels   = nullptr;
+		m_Capacity = 0;
+		m_Width    = m_Height = 0;
 	}
 
 	void Image::Load(const uint8_t *pixels, size_t size)
 	{
-		Clear();
+		const auto memory = FreeImage_OpenMemory(const_cast<uint8_t*>(pixels), static_cast<uint32_t>(size));
+		if(!memory)
+		{
+			throw std::runtime_error("Unable to open memory file");
+		}
+
+		const auto format = FreeImage_GetFileTypeFromMemory(memory, 0);
+		const auto image  = format != FIF_UNKNOWN ? FreeImage_LoadFromMemory(format, memory, 0) : nullptr;
+
+		FreeImage_CloseMemory(memory);
 
-		const auto format = FreeImage_GetFileTypeFromMemory(
-		                                                    reinterpret_cast<FIMEMORY*>(const_cast<uint8_t*>(pixels)),
-		                                                    static_cast<int>(size)
-		                                                   );
 		if(format == FIF_UNKNOWN)
 		{
 			throw std::runtime_error("Unknown image format");
 		}
 
-		const auto image = FreeImage_LoadFromMemory(
-		                                            format,
-		                                            reinterpret_cast<FIMEMORY*>(const_cast<uint8_t*>(pixels)),
-		                                            static_cast<int>(size)
-		                                           );
 		if(!image)
 		{
 			throw std::runtime_error("Unable to open memory file");
@@ -170,12 +161,10 @@ namespace Game
 
 	void Image::Load(const std::string &fileName)
 	{
-		Clear();
-
-		std::ifstream file;
-		file.exceptions(std::ios::failbit | std::ios::badbit);
-		file.open(fileName);
-		file.close();
+		if(!std::filesystem::exists(fileName))
+		{
+			throw std::runtime_error(fmt::format("File not found: {}", fileName));
+		}
 
 		const auto format = FreeImage_GetFileType(fileName.c_str(), 0);
 		if(format == FIF_UNKNOWN)
@@ -193,33 +182,37 @@ namespace Game
 		FreeImage_Unload(image);
 	}
 
-	void Image::Save(const std::string &fileName, ImageType type)
+	void Image::Save(const std::string &fileName, ImageType type) const
 	{
-		auto handler = FreeImage_Allocate(
-		                                  static_cast<int>(m_Width),
-		                                  static_cast<int>(m_Height),
-		                                  32,
-		                                  FI_RGBA_RED_MASK,
-		                                  FI_RGBA_GREEN_MASK,
-		                                  FI_RGBA_BLUE_MASK
-		                                 );
+		const auto handler = static_cast<FIBITMAP*>(SaveToMemory());
 
-		for(size_t i = 0; i < m_Width; ++i)
-			for(size_t j = 0; j < m_Height; ++j)
-			{
-				RGBQUAD color;
+		FreeImage_Save(ConvertType(type), handler, fileName.c_str(), 0);
+		FreeImage_Unload(handler);
+	}
 
-				const auto pixel  = m_Pixels[i + j * m_Width];
-				color.rgbRed      = static_cast<BYTE>(pixel.R);
-				color.rgbGreen    = static_cast<BYTE>(pixel.G);
-				color.rgbBlue     = static_cast<BYTE>(pixel.B);
-				color.rgbReserved = static_cast<BYTE>(pixel.A);
+	std::vector<uint8_t> Image::Encode(ImageType type) const
+	{
+		const auto handler = static_cast<FIBITMAP*>(SaveToMemory());
+		const auto memory  = FreeImage_OpenMemory();
 
-				FreeImage_SetPixelColor(handler, static_cast<uint32_t>(i), static_cast<uint32_t>(j), &color);
-			}
+		std::vector<uint8_t> result;
 
-		FreeImage_Save(ConvertType(type), handler, fileName.c_str(), 0);
+		if(FreeImage_SaveToMemory(ConvertType(type), handler, memory, 0))
+		{
+			BYTE *data = nullptr;
+			DWORD size = 0;
+
+			FreeImage_AcquireMemory(memory, &data, &size);
+			result.assign(data, data + size);
+		}
+
+		FreeImage_CloseMemory(memory);
 		FreeImage_Unload(handler);
+
+		if(result.empty())
+			throw std::runtime_error("Unable to encode image");
+
+		return result;
 	}
 
 	Color& Image::GetPixel(uint32_t x, uint32_t y)
@@ -247,55 +240,77 @@ namespace Game
 
 	Image& Image::operator=(Image &&image) noexcept
 	{
+		if(this == &image)
+			return *this;
+
 		Clear();
-		m_Width  = image.m_Width;
-		m_Height = image.m_Height;
 
-		m_Pixels       = image.m_Pixels;
-		image.m_Pixels = nullptr;
+		m_Pixels   = std::exchange(image.m_Pixels, nullptr);
+		m_Capacity = std::exchange(image.m_Capacity, 0);
+		m_Width    = std::exchange(image.m_Width, 0);
+		m_Height   = std::exchange(image.m_Height, 0);
 
 		return *this;
 	}
 
 	Image& Image::operator=(const Image &image)
 	{
-		Clear();
-		m_Width  = image.m_Width;
-		m_Height = image.m_Height;
-
-		const size_t size = static_cast<size_t>(m_Width) * m_Height;
+		if(this == &image)
+			return *this;
 
-		m_Pixels = new Color[size];
+		Resize(image.m_Width, image.m_Height);
 
-		std::memcpy(m_Pixels, image.m_Pixels, size * sizeof(Color));
+		if(image.m_Pixels)
+			std::memcpy(m_Pixels, image.m_Pixels, static_cast<size_t>(m_Width) * m_Height * sizeof(Color));
 
 		return *this;
 	}
 
+	void Image::FlipVertically()
+	{
+		PixelConversion::FlipRows(m_Pixels, m_Pixels, static_cast<size_t>(m_Width) * sizeof(Color), m_Height);
+	}
+
 	void Image::LoadToMemory(void *imageFile)
 	{
 		auto image = static_cast<FIBITMAP*>(imageFile);
 		image      = FreeImage_ConvertTo32Bits(image);
 
-		m_Width  = FreeImage_GetWidth(image);
-		m_Height = FreeImage_GetHeight(image);
+		const uint32_t width  = FreeImage_GetWidth(image);
+		const uint32_t height = FreeImage_GetHeight(image);
 
-		const size_t size = static_cast<size_t>(m_Width) * m_Height;
+		Resize(width, height);
 
-		auto pixels = FreeImage_GetBits(image);
+		for(uint32_t y = 0; y < m_Height; ++y)
+			CopyRow(FreeImage_GetScanLine(image, static_cast<int>(y)), m_Pixels + static_cast<size_t>(y) * m_Width);
 
-		m_Pixels = new Color[size];
+		FreeImage_Unload(image);
+	}
 
-		for(size_t i = 0; i < size; ++i)
-		{
-			m_Pixels[i] = Color(
-			                    pixels[i * 4 + FI_RGBA_RED],
-			                    pixels[i * 4 + FI_RGBA_GREEN],
-			                    pixels[i * 4 + FI_RGBA_BLUE],
-			                    pixels[i * 4 + FI_RGBA_ALPHA]
-			                   );
-		}
+	void* Image::SaveToMemory() const
+	{
+		auto handler = FreeImage_Allocate(
+		                                  static_cast<int>(m_Width),
+		                                  static_cast<int>(m_Height),
+		                                  32,
+		                                  FI_RGBA_RED_MASK,
+		                                  FI_RGBA_GREEN_MASK,
+		                                  FI_RGBA_BLUE_MASK
+		                                 );
 
-		FreeImage_Unload(image);
+		for(uint32_t y = 0; y < m_Height; ++y)
+			CopyRow(m_Pixels + static_cast<size_t>(y) * m_Width, FreeImage_GetScanLine(handler, static_cast<int>(y)));
+
+		return handler;
+	}
+
+	void Image::CopyRow(const void *source, void *destination) const
+	{
+		// FreeImage stores 32 bit pixels as BGRA on little endian machines, the conversion is symmetric
+#if FREEIMAGE_COLORORDER == FREEIMAGE_COLORORDER_BGR
+		PixelConversion::SwizzleRedBlue(static_cast<const uint8_t*>(source), static_cast<uint8_t*>(destination), m_Width);
+#else
+		std::memcpy(destination, source, static_cast<size_t>(m_Width) * sizeof(Color));
+#endif
 	}
 }
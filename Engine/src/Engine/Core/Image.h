@@ -2,9 +2,11 @@
 
 #include "Engine/Core/Base.h"
 #include "Engine/Core/Color.h"
+#include "Engine/Core/ImageView.h"
 #include "Engine/Core/Vector2.h"
 
 #include <string>
+#include <vector>
 
 namespace Game
 {
@@ -29,6 +31,9 @@ namespace Game
 		uint32_t m_Width  = 0;
 		uint32_t m_Height = 0;
 
+		// Size of the pooled buffer in bytes, may be larger than the pixels in use
+		size_t m_Capacity = 0;
+
 	
 	public:
 		Image() = default;
@@ -45,6 +50,8 @@ namespace Game
 		Image(const Vector2u& size, const glm::vec4 *pixels);
 		Image(const Vector2u& size, const float *pixels);
 
+		explicit Image(const ConstImageView& view);
+
 		Image(const Image& image);
 		Image(Image&& image) noexcept;
 
@@ -57,18 +64,32 @@ namespace Game
 			return Create(size.Width, size.Height, background);
 		}
 
+		// Keeps the current storage when it is large enough, pixel contents are left undefined
+		void Resize(uint32_t width, uint32_t height);
+		void Resize(const Vector2u& size) { Resize(size.Width, size.Height); }
+
 		void Clear();
 
 		void Load(const uint8_t *pixels, size_t size);
 		void Load(const std::string& fileName);
 		
-		void Save(const std::string& fileName, ImageType type);
+		void Save(const std::string& fileName, ImageType type) const;
+		std::vector<uint8_t> Encode(ImageType type) const;
+
+		void FlipVertically();
 
 		uint32_t Width() const { return m_Width; }
 		uint32_t Height() const { return m_Height; }
 		Vector2u Size() const { return Vector2u(m_Width, m_Height); }
 
 		const Color* GetPixels() const { return m_Pixels; }
+		size_t Capacity() const { return m_Capacity / sizeof(Color); }
+
+		ImageView View() { return ImageView(m_Pixels, m_Width, m_Height); }
+		ConstImageView View() const { return ConstImageView(m_Pixels, m_Width, m_Height); }
+
+		ImageView View(const UIntRect& rect) { return View().SubView(rect); }
+		ConstImageView View(const UIntRect& rect) const { return View().SubView(rect); }
 
 		Color& GetPixel(const Vector2u& position) { return GetPixel(position.X, position.Y); } 
 		const Color& GetPixel(const Vector2u& position) const { return GetPixel(position.X, position.Y); } 
@@ -97,5 +118,7 @@ namespace Game
 
 	private:
 		void LoadToMemory(void *imageFile);
+		void* SaveToMemory() const;
+		void CopyRow(const void *source, void *destination) const;
 	};
 }
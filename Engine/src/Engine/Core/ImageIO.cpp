@@ -0,0 +1,185 @@
+#include "pch.h"
+#include "ImageIO.h"
+
+#include "Log.h"
+
+namespace Game
+{
+	void ImageIO::Reserve(size_t count, const Vector2u &size)
+	{
+		std::vector<Image> images(count);
+		for(auto &image : images)
+			image.Create(size);
+
+		std::scoped_lock lock(s_Mutex);
+
+		s_PoolLimit = std::max(s_PoolLimit, s_Free.size() + count);
+		for(auto &image : images)
+			s_Free.emplace_back(std::move(image));
+	}
+
+	void ImageIO::Recycle(Image &&image)
+	{
+		if(!image.GetPixels())
+			return;
+
+		std::scoped_lock lock(s_Mutex);
+
+		if(s_Free.size() < s_PoolLimit)
+			s_Free.emplace_back(std::move(image));
+	}
+
+	void ImageIO::SetPoolLimit(size_t limit)
+	{
+		std::scoped_lock lock(s_Mutex);
+
+		s_PoolLimit = limit;
+		if(s_Free.size() > limit)
+			s_Free.resize(limit);
+	}
+
+	size_t ImageIO::GetPooledCount()
+	{
+		std::scoped_lock lock(s_Mutex);
+		return s_Free.size();
+	}
+
+	void ImageIO::Shutdown()
+	{
+		if(s_Pool)
+			s_Pool->Wait();
+
+		std::scoped_lock lock(s_Mutex);
+		s_Free.clear();
+		s_Free.shrink_to_fit();
+
+		s_Pool = nullptr;
+	}
+
+	std::future<Image> ImageIO::LoadAsync(const std::string &path)
+	{
+		return Dispatch(
+		                [path]()
+		                {
+			                auto image = Acquire();
+
+			                try
+			                {
+				                image.Load(path);
+			                }
+			                catch(...)
+			                {
+				                LOG_ERROR("Unable to load image: {}", path);
+				                Recycle(std::move(image));
+				                throw;
+			                }
+
+			                return image;
+		                }
+		               );
+	}
+
+	std::future<Image> ImageIO::LoadAsync(Blob data)
+	{
+		return Dispatch(
+		                [data = std::move(data)]()
+		                {
+			                auto image = Acquire();
+
+			                try
+			                {
+				                image.Load(data.data(), data.size());
+			                }
+			                catch(...)
+			                {
+				                LOG_ERROR("Unable to decode image from memory ({} bytes)", data.size());
+				                Recycle(std::move(image));
+				                throw;
+			                }
+
+			                return image;
+		                }
+		               );
+	}
+
+	std::vector<std::future<Image>> ImageIO::LoadAsync(const std::vector<std::string> &paths)
+	{
+		std::vector<std::future<Image>> result;
+		result.reserve(paths.size());
+
+		for(const auto &path : paths)
+			result.emplace_back(LoadAsync(path));
+
+		return result;
+	}
+
+	std::vector<std::future<Image>> ImageIO::LoadAsync(std::vector<Blob> blobs)
+	{
+		std::vector<std::future<Image>> result;
+		result.reserve(blobs.size());
+
+		for(auto &blob : blobs)
+			result.emplace_back(LoadAsync(std::move(blob)));
+
+		return result;
+	}
+
+	std::future<void> ImageIO::SaveAsync(Image image, const std::string &path, ImageType type)
+	{
+		return Dispatch(
+		                [image = std::move(image), path, type]() mutable
+		                {
+			                image.Save(path, type);
+			                Recycle(std::move(image));
+		                }
+		               );
+	}
+
+	std::vector<std::future<void>> ImageIO::SaveAsync(std::vector<SaveRequest> requests)
+	{
+		std::vector<std::future<void>> result;
+		result.reserve(requests.size());
+
+		for(auto &request : requests)
+			result.emplace_back(SaveAsync(std::move(request.Pixels), request.Path, request.Type));
+
+		return result;
+	}
+
+	std::future<ImageIO::Blob> ImageIO::EncodeAsync(Image image, ImageType type)
+	{
+		return Dispatch(
+		                [image = std::move(image), type]() mutable
+		                {
+			                auto data = image.Encode(type);
+			                Recycle(std::move(image));
+
+			                return data;
+		                }
+		               );
+	}
+
+	std::vector<std::future<ImageIO::Blob>> ImageIO::EncodeAsync(std::vector<Image> images, ImageType type)
+	{
+		std::vector<std::future<Blob>> result;
+		result.reserve(images.size());
+
+		for(auto &image : images)
+			result.emplace_back(EncodeAsync(std::move(image), type));
+
+		return result;
+	}
+
+	Image ImageIO::Acquire()
+	{
+		std::scoped_lock lock(s_Mutex);
+
+		if(s_Free.empty())
+			return {};
+
+		auto image = std::move(s_Free.back());
+		s_Free.pop_back();
+
+		return image;
+	}
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/Core/Image.h"
+#include "Engine/Core/ThreadPool.h"
+
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Game
+{
+	class ImageIO
+	{
+	public:
+		using Blob = std::vector<uint8_t>;
+
+		struct SaveRequest
+		{
+			Image Pixels;
+			std::string Path;
+			ImageType Type = ImageType::PNG;
+		};
+
+	private:
+		static inline ThreadPool *s_Pool = nullptr;
+
+		static inline std::mutex s_Mutex;
+		static inline std::vector<Image> s_Free;
+		static inline size_t s_PoolLimit = 16;
+
+	public:
+		static void SetThreadPool(ThreadPool *pool) { s_Pool = pool; }
+
+		static void Reserve(size_t count, const Vector2u &size);
+		static void Recycle(Image &&image);
+		static void SetPoolLimit(size_t limit);
+		static size_t GetPooledCount();
+		static void Shutdown();
+
+		static std::future<Image> LoadAsync(const std::string &path);
+		static std::future<Image> LoadAsync(Blob data);
+
+		static std::vector<std::future<Image>> LoadAsync(const std::vector<std::string> &paths);
+		static std::vector<std::future<Image>> LoadAsync(std::vector<Blob> blobs);
+
+		static std::future<void> SaveAsync(Image image, const std::string &path, ImageType type);
+		static std::vector<std::future<void>> SaveAsync(std::vector<SaveRequest> requests);
+
+		static std::future<Blob> EncodeAsync(Image image, ImageType type);
+		static std::vector<std::future<Blob>> EncodeAsync(std::vector<Image> images, ImageType type);
+
+	private:
+		static Image Acquire();
+
+		template <typename Func>
+		static auto Dispatch(Func &&func) -> std::future<std::invoke_result_t<Func>>
+		{
+			if(s_Pool)
+				return s_Pool->Submit(std::forward<Func>(func));
+
+			std::packaged_task<std::invoke_result_t<Func>()> task(std::forward<Func>(func));
+			auto future = task.get_future();
+			task();
+
+			return future;
+		}
+	};
+}
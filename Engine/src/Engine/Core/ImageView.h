@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/Core/Assert.h"
+#include "Engine/Core/Color.h"
+#include "Engine/Core/Rect.h"
+#include "Engine/Core/Vector2.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+namespace Game
+{
+	// Non owning window into pixel storage, the stride is measured in pixels and may be larger than the width
+	template <typename Type>
+	class BasicImageView
+	{
+		static_assert(std::is_same_v<std::remove_const_t<Type>, Color>);
+
+		Type *m_Pixels    = nullptr;
+		uint32_t m_Width  = 0;
+		uint32_t m_Height = 0;
+		size_t m_Stride   = 0;
+
+	public:
+		constexpr BasicImageView() = default;
+
+		constexpr BasicImageView(Type *pixels, uint32_t width, uint32_t height, size_t stride) : m_Pixels(pixels),
+		                                                                                        m_Width(width),
+		                                                                                        m_Height(height),
+		                                                                                        m_Stride(stride) {}
+
+		constexpr BasicImageView(Type *pixels, uint32_t width, uint32_t height) : BasicImageView(pixels, width, height, width) {}
+
+		template <typename Other, typename = std::enable_if_t<std::is_convertible_v<Other*, Type*>>>
+		constexpr BasicImageView(const BasicImageView<Other> &view) : BasicImageView(view.Data(), view.Width(), view.Height(), view.Stride()) {}
+
+		BasicImageView SubView(const UIntRect &rect) const
+		{
+			ASSERT(rect.X + rect.Width <= m_Width && rect.Y + rect.Height <= m_Height, "Out of range");
+			if(rect.X + rect.Width > m_Width || rect.Y + rect.Height > m_Height)
+				throw std::out_of_range("Out of range");
+
+			return BasicImageView(m_Pixels + rect.X + rect.Y * m_Stride, rect.Width, rect.Height, m_Stride);
+		}
+
+		Type* Row(uint32_t y) const { return m_Pixels + y * m_Stride; }
+
+		Type& GetPixel(uint32_t x, uint32_t y) const
+		{
+			ASSERT(x < m_Width && y < m_Height, "Out of range");
+			if(x >= m_Width || y >= m_Height)
+				throw std::out_of_range("Out of range");
+
+			return m_Pixels[x + y * m_Stride];
+		}
+
+		Type& GetPixel(const Vector2u &position) const { return GetPixel(position.X, position.Y); }
+		Type& operator()(uint32_t x, uint32_t y) const { return m_Pixels[x + y * m_Stride]; }
+
+		void Fill(const Color &color) const requires (!std::is_const_v<Type>)
+		{
+			for(uint32_t y = 0; y < m_Height; ++y)
+				std::fill_n(Row(y), m_Width, color);
+		}
+
+		// Views have to be the same size, overlapping views are not supported
+		void CopyFrom(const BasicImageView<const Color> &source) const requires (!std::is_const_v<Type>)
+		{
+			ASSERT(source.Width() == m_Width && source.Height() == m_Height, "Size mismatch");
+			if(source.Width() != m_Width || source.Height() != m_Height)
+				throw std::invalid_argument("Size mismatch");
+
+			if(IsContiguous() && source.IsContiguous())
+			{
+				std::memcpy(m_Pixels, source.Data(), static_cast<size_t>(m_Width) * m_Height * sizeof(Color));
+				return;
+			}
+
+			for(uint32_t y = 0; y < m_Height; ++y)
+				std::memcpy(Row(y), source.Row(y), static_cast<size_t>(m_Width) * sizeof(Color));
+		}
+
+		Type* Data() const { return m_Pixels; }
+
+		uint32_t Width() const { return m_Width; }
+		uint32_t Height() const { return m_Height; }
+		Vector2u Size() const { return Vector2u(m_Width, m_Height); }
+		size_t Stride() const { return m_Stride; }
+
+		bool Empty() const { return !m_Pixels || m_Width == 0 || m_Height == 0; }
+		bool IsContiguous() const { return m_Stride == m_Width; }
+	};
+
+	using ImageView = BasicImageView<Color>;
+	using ConstImageView = BasicImageView<const Color>;
+}
@@ -0,0 +1,527 @@
+#include "pch.h"
+#include "MipChain.h"
+
+#include "Assert.h"
+#include "Log.h"
+#include "PixelConversion.h"
+#include "ThreadPool.h"
+
+#include "Engine/Utils/Hash.h"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+namespace Game
+{
+	constexpr uint32_t MIP_CACHE_MAGIC   = 0x4350494D; // "MIPC"
+	constexpr uint32_t MIP_CACHE_VERSION = 1;
+	constexpr uint32_t LINEAR_TABLE_SIZE = 4096;
+	constexpr uint32_t MAX_CACHE_SIZE    = 1u << 16;
+
+	constexpr float PI = 3.14159265358979323846f;
+
+	struct CacheHeader
+	{
+		uint32_t Magic   = MIP_CACHE_MAGIC;
+		uint32_t Version = MIP_CACHE_VERSION;
+		uint64_t Key     = 0;
+		uint32_t Levels  = 0;
+		uint32_t Srgb    = 0;
+	};
+
+	struct FilterTap
+	{
+		uint32_t Begin = 0;
+		std::vector<float> Weights;
+	};
+
+	using Taps = std::vector<FilterTap>;
+
+	static uint32_t CalculateMaxLevels(uint32_t width, uint32_t height)
+	{
+		return static_cast<uint32_t>(std::floor(std::log2(static_cast<float>(std::max(width, height))))) + 1;
+	}
+
+	static const float* SrgbToLinearTable()
+	{
+		static const auto s_Table = []()
+		{
+			std::array<float, 256> table{};
+
+			for(size_t i = 0; i < table.size(); ++i)
+			{
+				const float value = static_cast<float>(i) / 255.f;
+				table[i]          = value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+			}
+
+			return table;
+		}();
+
+		return s_Table.data();
+	}
+
+	static const uint8_t* LinearToSrgbTable()
+	{
+		static const auto s_Table = []()
+		{
+			std::array<uint8_t, LINEAR_TABLE_SIZE> table{};
+
+			for(size_t i = 0; i < table.size(); ++i)
+			{
+				const float value = static_cast<float>(i) / static_cast<float>(LINEAR_TABLE_SIZE - 1);
+				const float srgb  = value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.f / 2.4f) - 0.055f;
+
+				table[i] = static_cast<uint8_t>(std::lrint(std::clamp(srgb, 0.f, 1.f) * 255.f));
+			}
+
+			return table;
+		}();
+
+		return s_Table.data();
+	}
+
+	static float BesselI0(float x)
+	{
+		float sum  = 1.f;
+		float term = 1.f;
+
+		for(int32_t i = 1; i < 32; ++i)
+		{
+			const float factor = x / (2.f * static_cast<float>(i));
+			term *= factor * factor;
+			sum += term;
+
+			if(term < sum * 1e-7f)
+				break;
+		}
+
+		return sum;
+	}
+
+	static float Sinc(float x)
+	{
+		if(std::abs(x) < 1e-5f)
+			return 1.f;
+
+		return std::sin(PI * x) / (PI * x);
+	}
+
+	// Resampling weights for every destination pixel along one axis, positions are measured in source pixels
+	static Taps CalculateTaps(uint32_t source, uint32_t destination, const MipChainSpecification &specification)
+	{
+		const float scale  = static_cast<float>(source) / static_cast<float>(destination);
+		const float radius = specification.Filter == MipFilter::Box ? scale * 0.5f : specification.KaiserWidth * scale;
+		const float norm   = BesselI0(specification.KaiserAlpha);
+
+		Taps taps(destination);
+
+		for(uint32_t i = 0; i < destination; ++i)
+		{
+			const float center = (static_cast<float>(i) + 0.5f) * scale;
+			const auto first   = static_cast<int32_t>(std::floor(center - radius));
+			const auto last    = static_cast<int32_t>(std::ceil(center + radius));
+
+			std::vector<float> weights;
+			weights.reserve(static_cast<size_t>(last - first));
+
+			float total = 0.f;
+			for(int32_t j = first; j < last; ++j)
+			{
+				float weight = 0.f;
+
+				if(specification.Filter == MipFilter::Box)
+				{
+					const float begin = std::max(static_cast<float>(j), center - radius);
+					const float end   = std::min(static_cast<float>(j + 1), center + radius);
+
+					weight = std::max(end - begin, 0.f);
+				}
+				else
+				{
+					const float distance = (static_cast<float>(j) + 0.5f - center) / scale;
+					const float ratio    = distance / specification.KaiserWidth;
+
+					if(std::abs(ratio) < 1.f)
+						weight = Sinc(distance) * BesselI0(specification.KaiserAlpha * std::sqrt(1.f - ratio * ratio)) / norm;
+				}
+
+				weights.emplace_back(weight);
+				total += weight;
+			}
+
+			for(auto &weight : weights)
+				weight /= total;
+
+			// Taps outside of the image are folded onto the edge, so clamp to edge addressing is baked into the weights
+			auto &tap = taps[i];
+			tap.Begin = static_cast<uint32_t>(std::clamp(first, 0, static_cast<int32_t>(source) - 1));
+
+			const auto end = static_cast<uint32_t>(std::clamp(last - 1, 0, static_cast<int32_t>(source) - 1)) + 1;
+			tap.Weights.assign(end - tap.Begin, 0.f);
+
+			for(size_t j = 0; j < weights.size(); ++j)
+			{
+				const int32_t index = std::clamp(first + static_cast<int32_t>(j), 0, static_cast<int32_t>(source) - 1);
+				tap.Weights[static_cast<uint32_t>(index) - tap.Begin] += weights[j];
+			}
+		}
+
+		return taps;
+	}
+
+	// Splits the range into bands processed by the pool and the calling thread, only waits for the bands themselves
+	// so it stays safe to call from inside a pool job
+	static void ParallelFor(ThreadPool *pool, uint32_t count, const std::function<void(uint32_t, uint32_t)> &job)
+	{
+		constexpr uint32_t BAND_SIZE = 16;
+
+		const uint32_t bands   = (count + BAND_SIZE - 1) / BAND_SIZE;
+		const uint32_t helpers = pool ? std::min(static_cast<uint32_t>(pool->Size()), bands - 1) : 0;
+
+		if(helpers == 0)
+		{
+			job(0, count);
+			return;
+		}
+
+		struct State
+		{
+			std::atomic<uint32_t> Next = 0;
+			std::atomic<uint32_t> Done = 0;
+			uint32_t Count             = 0;
+
+			std::function<void(uint32_t, uint32_t)> Job;
+
+			std::mutex Mutex;
+			std::condition_variable Finished;
+		};
+
+		auto state   = MakePointer<State>();
+		state->Count = count;
+		state->Job   = job;
+
+		const auto work = [](State &state)
+		{
+			for(uint32_t begin = state.Next.fetch_add(BAND_SIZE); begin < state.Count; begin = state.Next.fetch_add(BAND_SIZE))
+			{
+				const uint32_t end = std::min(begin + BAND_SIZE, state.Count);
+				state.Job(begin, end);
+
+				if(state.Done.fetch_add(end - begin) + (end - begin) == state.Count)
+				{
+					std::scoped_lock lock(state.Mutex);
+					state.Finished.notify_all();
+				}
+			}
+		};
+
+		for(uint32_t i = 0; i < helpers; ++i)
+			pool->Submit([state, work]() { work(*state); });
+
+		work(*state);
+
+		std::unique_lock lock(state->Mutex);
+		state->Finished.wait(lock, [&state]() { return state->Done == state->Count; });
+	}
+
+	MipChain::MipChain(const Image &image, const MipChainSpecification &specification)
+	{
+		Generate(image, specification);
+	}
+
+	void MipChain::Generate(const Image &image, const MipChainSpecification &specification)
+	{
+		ASSERT(image.GetPixels(), "Empty image");
+		if(!image.GetPixels())
+			throw std::invalid_argument("Empty image");
+
+		ASSERT(specification.Filter == MipFilter::Box || specification.KaiserWidth > 0.f, "Invalid Kaiser width");
+		if(specification.Filter == MipFilter::Kaiser && specification.KaiserWidth <= 0.f)
+			throw std::invalid_argument("Invalid Kaiser width");
+
+		Clear();
+		m_Srgb = specification.Srgb;
+
+		const auto maxLevels  = CalculateMaxLevels(image.Width(), image.Height());
+		const uint32_t levels = specification.Levels == 0 ? maxLevels : std::min(specification.Levels, maxLevels);
+
+		m_Levels.reserve(levels);
+		m_Levels.emplace_back(image);
+
+		const float *toLinear = SrgbToLinearTable();
+		const uint8_t *toSrgb = LinearToSrgbTable();
+
+		uint32_t width  = image.Width();
+		uint32_t height = image.Height();
+
+		std::vector<float> source(static_cast<size_t>(width) * height * 4);
+
+		ParallelFor(
+		            s_Pool,
+		            height,
+		            [&](uint32_t begin, uint32_t end)
+		            {
+			            const size_t offset = static_cast<size_t>(begin) * width * 4;
+			            const size_t count  = static_cast<size_t>(end - begin) * width * 4;
+
+			            const auto input = reinterpret_cast<const uint8_t*>(image.GetPixels()) + offset;
+			            float *output    = source.data() + offset;
+
+			            PixelConversion::Unorm8ToFloat(input, output, count);
+
+			            for(size_t i = 0; i < count; i += 4)
+			            {
+				            if(specification.Srgb)
+				            {
+					            for(size_t c = 0; c < 3; ++c)
+						            output[i + c] = toLinear[input[i + c]];
+				            }
+
+				            if(specification.PremultiplyAlpha)
+				            {
+					            for(size_t c = 0; c < 3; ++c)
+						            output[i + c] *= output[i + 3];
+				            }
+			            }
+		            }
+		           );
+
+		std::vector<float> vertical;
+		std::vector<float> destination;
+
+		for(uint32_t level = 1; level < levels; ++level)
+		{
+			const uint32_t nextWidth  = std::max(width / 2, 1u);
+			const uint32_t nextHeight = std::max(height / 2, 1u);
+
+			const Taps rows    = CalculateTaps(height, nextHeight, specification);
+			const Taps columns = CalculateTaps(width, nextWidth, specification);
+
+			const size_t sourceStride      = static_cast<size_t>(width) * 4;
+			const size_t destinationStride = static_cast<size_t>(nextWidth) * 4;
+
+			vertical.assign(static_cast<size_t>(nextHeight) * sourceStride, 0.f);
+			destination.resize(static_cast<size_t>(nextHeight) * destinationStride);
+
+			Image &output = m_Levels.emplace_back();
+			output.Resize(nextWidth, nextHeight);
+
+			ParallelFor(
+			            s_Pool,
+			            nextHeight,
+			            [&](uint32_t begin, uint32_t end)
+			            {
+				            for(uint32_t y = begin; y < end; ++y)
+				            {
+					            float *row = vertical.data() + y * sourceStride;
+
+					            const auto &tap = rows[y];
+					            for(size_t i = 0; i < tap.Weights.size(); ++i)
+						            PixelConversion::MultiplyAdd(source.data() + (tap.Begin + i) * sourceStride, tap.Weights[i], row, sourceStride);
+
+					            float *target = destination.data() + y * destinationStride;
+					            for(uint32_t x = 0; x < nextWidth; ++x)
+					            {
+						            const auto &column = columns[x];
+
+						            float pixel[4] = {};
+						            for(size_t i = 0; i < column.Weights.size(); ++i)
+						            {
+							            const float *sample = row + (column.Begin + i) * 4;
+							            for(size_t c = 0; c < 4; ++c)
+								            pixel[c] += sample[c] * column.Weights[i];
+						            }
+
+						            std::copy_n(pixel, 4, target + x * 4);
+					            }
+
+					            auto pixels = reinterpret_cast<uint8_t*>(&output.GetPixel(0, y));
+					            for(uint32_t x = 0; x < nextWidth; ++x)
+					            {
+						            const float *pixel = target + x * 4;
+						            const float alpha  = std::clamp(pixel[3], 0.f, 1.f);
+						            const float scale  = specification.PremultiplyAlpha ? (alpha > 0.f ? 1.f / alpha : 0.f) : 1.f;
+
+						            for(size_t c = 0; c < 3; ++c)
+						            {
+							            const float value = std::clamp(pixel[c] * scale, 0.f, 1.f);
+
+							            pixels[x * 4 + c] = specification.Srgb
+								                                ? toSrgb[static_cast<size_t>(std::lrint(value * static_cast<float>(LINEAR_TABLE_SIZE - 1)))]
+								                                : static_cast<uint8_t>(std::lrint(value * 255.f));
+						            }
+
+						            pixels[x * 4 + 3] = static_cast<uint8_t>(std::lrint(alpha * 255.f));
+					            }
+				            }
+			            }
+			           );
+
+			std::swap(source, destination);
+
+			width  = nextWidth;
+			height = nextHeight;
+		}
+	}
+
+	void MipChain::Clear()
+	{
+		m_Levels.clear();
+		m_Srgb = false;
+	}
+
+	bool MipChain::Load(const std::string &fileName, uint64_t key)
+	{
+		std::ifstream file(fileName, std::ios::binary);
+		if(!file.is_open())
+			return false;
+
+		file.seekg(0, std::ios::end);
+		uint64_t remaining = static_cast<uint64_t>(file.tellg());
+		file.seekg(0, std::ios::beg);
+
+		CacheHeader header;
+		file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+		if(!file || header.Magic != MIP_CACHE_MAGIC || header.Version != MIP_CACHE_VERSION)
+		{
+			LOG_WARN("Invalid mip chain cache: {}", fileName);
+			return false;
+		}
+
+		if(header.Key != key)
+			return false;
+
+		remaining -= sizeof(header);
+
+		// Every level takes at least its size and one pixel, a count the file cannot hold is never allocated
+		constexpr uint64_t MIN_LEVEL_SIZE = sizeof(uint32_t[2]) + sizeof(Color);
+
+		if(header.Levels == 0 || header.Levels > CalculateMaxLevels(MAX_CACHE_SIZE, MAX_CACHE_SIZE) || header.Levels > remaining / MIN_LEVEL_SIZE)
+		{
+			LOG_WARN("Corrupted mip chain cache: {}", fileName);
+			return false;
+		}
+
+		std::vector<Image> levels(header.Levels);
+		for(auto &level : levels)
+		{
+			uint32_t size[2] = {};
+			file.read(reinterpret_cast<char*>(size), sizeof(size));
+
+			if(!file || size[0] == 0 || size[1] == 0 || size[0] > MAX_CACHE_SIZE || size[1] > MAX_CACHE_SIZE)
+			{
+				LOG_WARN("Corrupted mip chain cache: {}", fileName);
+				return false;
+			}
+
+			remaining -= sizeof(size);
+
+			const uint64_t bytes = static_cast<uint64_t>(size[0]) * size[1] * sizeof(Color);
+
+			if(bytes > remaining || (&level == levels.data() && header.Levels > CalculateMaxLevels(size[0], size[1])))
+			{
+				LOG_WARN("Corrupted mip chain cache: {}", fileName);
+				return false;
+			}
+
+			remaining -= bytes;
+
+			level.Resize(size[0], size[1]);
+			file.read(reinterpret_cast<char*>(level.begin()), static_cast<std::streamsize>(bytes));
+
+			if(!file)
+			{
+				LOG_WARN("Corrupted mip chain cache: {}", fileName);
+				return false;
+			}
+		}
+
+		m_Levels = std::move(levels);
+		m_Srgb   = header.Srgb != 0;
+
+		return true;
+	}
+
+	void MipChain::Save(const std::string &fileName, uint64_t key) const
+	{
+		std::ofstream file;
+		file.exceptions(std::ios::failbit | std::ios::badbit);
+		file.open(fileName, std::ios::binary | std::ios::trunc);
+
+		CacheHeader header;
+		header.Key    = key;
+		header.Levels = Levels();
+		header.Srgb   = m_Srgb ? 1 : 0;
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+		for(const auto &level : m_Levels)
+		{
+			const uint32_t size[2] = {level.Width(), level.Height()};
+
+			file.write(reinterpret_cast<const char*>(size), sizeof(size));
+			file.write(reinterpret_cast<const char*>(level.GetPixels()), static_cast<std::streamsize>(static_cast<size_t>(size[0]) * size[1] * sizeof(Color)));
+		}
+	}
+
+	MipChain MipChain::LoadOrGenerate(const Image &image, const std::string &cacheFile, const MipChainSpecification &specification)
+	{
+		const uint64_t key = CalculateKey(image, specification);
+
+		MipChain chain;
+		if(chain.Load(cacheFile, key))
+			return chain;
+
+		LOG_DEBUG("Generating mip chain: {}", cacheFile);
+		chain.Generate(image, specification);
+
+		try
+		{
+			if(const auto directory = std::filesystem::path(cacheFile).parent_path(); !directory.empty())
+				std::filesystem::create_directories(directory);
+
+			chain.Save(cacheFile, key);
+		}
+		catch(std::exception &ex)
+		{
+			LOG_WARN("Unable to write mip chain cache {}: {}", cacheFile, ex.what());
+		}
+
+		return chain;
+	}
+
+	uint64_t MipChain::CalculateKey(const Image &image, const MipChainSpecification &specification)
+	{
+		uint64_t key = HashValue(MIP_CACHE_VERSION);
+
+		key = HashCombine(key, HashValue(image.Width()));
+		key = HashCombine(key, HashValue(image.Height()));
+		key = HashCombine(key, HashValue(specification.Filter));
+		key = HashCombine(key, HashValue(specification.Srgb));
+		key = HashCombine(key, HashValue(specification.PremultiplyAlpha));
+		key = HashCombine(key, HashValue(specification.Levels));
+
+		if(specification.Filter == MipFilter::Kaiser)
+		{
+			key = HashCombine(key, HashValue(specification.KaiserWidth));
+			key = HashCombine(key, HashValue(specification.KaiserAlpha));
+		}
+
+		if(image.GetPixels())
+			key = HashCombine(key, Hash(image.GetPixels(), static_cast<size_t>(image.Width()) * image.Height() * sizeof(Color)));
+
+		return key;
+	}
+
+	const Image& MipChain::GetLevel(uint32_t level) const
+	{
+		ASSERT(level < m_Levels.size(), "Level out of range");
+		if(level >= m_Levels.size())
+			throw std::out_of_range("Level out of range");
+
+		return m_Levels[level];
+	}
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/Core/Image.h"
+
+#include <string>
+#include <vector>
+
+namespace Game
+{
+	class ThreadPool;
+
+	enum class MipFilter
+	{
+		Box,
+		Kaiser
+	};
+
+	struct MipChainSpecification
+	{
+		MipFilter Filter = MipFilter::Box;
+
+		// Treats color channels as sRGB and filters them in linear space
+		bool Srgb             = true;
+		bool PremultiplyAlpha = true;
+
+		// Zero generates the full chain down to 1x1
+		uint32_t Levels = 0;
+
+		// Radius in destination pixels and shape of the Kaiser window
+		float KaiserWidth = 3.f;
+		float KaiserAlpha = 4.f;
+	};
+
+	class MipChain
+	{
+		static inline ThreadPool *s_Pool = nullptr;
+
+		std::vector<Image> m_Levels;
+		bool m_Srgb = false;
+
+	public:
+		MipChain() = default;
+		explicit MipChain(const Image &image, const MipChainSpecification &specification = {});
+
+		void Generate(const Image &image, const MipChainSpecification &specification = {});
+		void Clear();
+
+		// Returns false when the file is missing, corrupted or was generated for a different key
+		bool Load(const std::string &fileName, uint64_t key = 0);
+		void Save(const std::string &fileName, uint64_t key = 0) const;
+
+		static MipChain LoadOrGenerate(const Image &image, const std::string &cacheFile, const MipChainSpecification &specification = {});
+		static uint64_t CalculateKey(const Image &image, const MipChainSpecification &specification);
+
+		static void SetThreadPool(ThreadPool *pool) { s_Pool = pool; }
+
+		bool Empty() const { return m_Levels.empty(); }
+		bool IsSrgb() const { return m_Srgb; }
+
+		uint32_t Levels() const { return static_cast<uint32_t>(m_Levels.size()); }
+		const Image& GetLevel(uint32_t level) const;
+
+		Vector2u Size() const { return m_Levels.empty() ? Vector2u{} : m_Levels.front().Size(); }
+
+		std::vector<Image>::const_iterator begin() const { return m_Levels.begin(); }
+		std::vector<Image>::const_iterator end() const { return m_Levels.end(); }
+	};
+}
@@ -0,0 +1,388 @@
+#include "pch.h"
+#include "Engine/Core/PixelConversion.h"
+
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define GAME_PIXEL_SIMD 1
+
+#include <immintrin.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#define GAME_TARGET(x)
+#else
+#include <cpuid.h>
+#define GAME_TARGET(x) __attribute__((target(x)))
+#endif
+#endif
+
+namespace Game
+{
+	static void SwizzleScalar(const uint8_t *source, uint8_t *destination, size_t pixels)
+	{
+		for(size_t i = 0; i < pixels; ++i)
+		{
+			const uint8_t red  = source[i * 4 + 0];
+			const uint8_t blue = source[i * 4 + 2];
+
+			destination[i * 4 + 0] = blue;
+			destination[i * 4 + 1] = source[i * 4 + 1];
+			destination[i * 4 + 2] = red;
+			destination[i * 4 + 3] = source[i * 4 + 3];
+		}
+	}
+
+	static void FloatToUnorm8Scalar(const float *source, uint8_t *destination, size_t count)
+	{
+		for(size_t i = 0; i < count; ++i)
+			destination[i] = static_cast<uint8_t>(std::lrint(std::clamp(source[i], 0.f, 1.f) * 255.f));
+	}
+
+	static void Unorm8ToFloatScalar(const uint8_t *source, float *destination, size_t count)
+	{
+		for(size_t i = 0; i < count; ++i)
+			destination[i] = static_cast<float>(source[i]) * (1.f / 255.f);
+	}
+
+	static void MultiplyAddScalar(const float *source, float weight, float *destination, size_t count)
+	{
+		for(size_t i = 0; i < count; ++i)
+			destination[i] += source[i] * weight;
+	}
+
+#ifdef GAME_PIXEL_SIMD
+	GAME_TARGET("sse4.1")
+	static size_t SwizzleSSE41(const uint8_t *source, uint8_t *destination, size_t pixels)
+	{
+		const __m128i mask = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+		size_t i = 0;
+		for(; i + 4 <= pixels; i += 4)
+		{
+			const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 4));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i * 4), _mm_shuffle_epi8(value, mask));
+		}
+
+		return i;
+	}
+
+	GAME_TARGET("avx2")
+	static size_t SwizzleAVX2(const uint8_t *source, uint8_t *destination, size_t pixels)
+	{
+		const __m256i mask = _mm256_setr_epi8(
+		                                      2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+		                                      2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15
+		                                     );
+
+		size_t i = 0;
+		for(; i + 8 <= pixels; i += 8)
+		{
+			const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i * 4));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i * 4), _mm256_shuffle_epi8(value, mask));
+		}
+
+		return i;
+	}
+
+	GAME_TARGET("sse4.1")
+	static __m128i ConvertSSE41(const float *data)
+	{
+		const __m128 value = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(data), _mm_setzero_ps()), _mm_set1_ps(1.f));
+		return _mm_cvtps_epi32(_mm_mul_ps(value, _mm_set1_ps(255.f)));
+	}
+
+	GAME_TARGET("sse4.1")
+	static size_t FloatToUnorm8SSE41(const float *source, uint8_t *destination, size_t count)
+	{
+		size_t i = 0;
+		for(; i + 16 <= count; i += 16)
+		{
+			const __m128i low  = _mm_packus_epi32(ConvertSSE41(source + i), ConvertSSE41(source + i + 4));
+			const __m128i high = _mm_packus_epi32(ConvertSSE41(source + i + 8), ConvertSSE41(source + i + 12));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_packus_epi16(low, high));
+		}
+
+		return i;
+	}
+
+	GAME_TARGET("avx2")
+	static __m256i ConvertAVX2(const float *data)
+	{
+		const __m256 value = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(data), _mm256_setzero_ps()), _mm256_set1_ps(1.f));
+		return _mm256_cvtps_epi32(_mm256_mul_ps(value, _mm256_set1_ps(255.f)));
+	}
+
+	GAME_TARGET("avx2")
+	static size_t FloatToUnorm8AVX2(const float *source, uint8_t *destination, size_t count)
+	{
+		// packus works per 128 bit lane, this restores the original dword order
+		const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+		size_t i = 0;
+		for(; i + 32 <= count; i += 32)
+		{
+			const __m256i low    = _mm256_packus_epi32(ConvertAVX2(source + i), ConvertAVX2(source + i + 8));
+			const __m256i high   = _mm256_packus_epi32(ConvertAVX2(source + i + 16), ConvertAVX2(source + i + 24));
+			const __m256i packed = _mm256_packus_epi16(low, high);
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i), _mm256_permutevar8x32_epi32(packed, order));
+		}
+
+		return i;
+	}
+
+	GAME_TARGET("sse4.1")
+	static size_t Unorm8ToFloatSSE41(const uint8_t *source, float *destination, size_t count)
+	{
+		const __m128 scale = _mm_set1_ps(1.f / 255.f);
+
+		size_t i = 0;
+		for(; i + 4 <= count; i += 4)
+		{
+			int32_t packed;
+			std::memcpy(&packed, source + i, sizeof(packed));
+
+			const __m128i value = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed));
+			_mm_storeu_ps(destination + i, _mm_mul_ps(_mm_cvtepi32_ps(value), scale));
+		}
+
+		return i;
+	}
+
+	GAME_TARGET("avx2")
+	static size_t Unorm8ToFloatAVX2(const uint8_t *source, float *destination, size_t count)
+	{
+		const __m256 scale = _mm256_set1_ps(1.f / 255.f);
+
+		size_t i = 0;
+		for(; i + 8 <= count; i += 8)
+		{
+			const __m256i value = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(source + i)));
+			_mm256_storeu_ps(destination + i, _mm256_mul_ps(_mm256_cvtepi32_ps(value), scale));
+		}
+
+		return i;
+	}
+
+	// Multiply and add are kept separate so every level produces the same result as the scalar loop
+	GAME_TARGET("sse4.1")
+	static size_t MultiplyAddSSE41(const float *source, float weight, float *destination, size_t count)
+	{
+		const __m128 factor = _mm_set1_ps(weight);
+
+		size_t i = 0;
+		for(; i + 4 <= count; i += 4)
+		{
+			const __m128 value = _mm_mul_ps(_mm_loadu_ps(source + i), factor);
+			_mm_storeu_ps(destination + i, _mm_add_ps(_mm_loadu_ps(destination + i), value));
+		}
+
+		return i;
+	}
+
+	GAME_TARGET("avx2")
+	static size_t MultiplyAddAVX2(const float *source, float weight, float *destination, size_t count)
+	{
+		const __m256 factor = _mm256_set1_ps(weight);
+
+		size_t i = 0;
+		for(; i + 8 <= count; i += 8)
+		{
+			const __m256 value = _mm256_mul_ps(_mm256_loadu_ps(source + i), factor);
+			_mm256_storeu_ps(destination + i, _mm256_add_ps(_mm256_loadu_ps(destination + i), value));
+		}
+
+		return i;
+	}
+
+	static SimdLevel DetectSimdLevel()
+	{
+		int32_t info[4] = {};
+
+#ifdef _MSC_VER
+		__cpuid(info, 0);
+		const int32_t maxLeaf = info[0];
+
+		__cpuid(info, 1);
+#else
+		const int32_t maxLeaf = static_cast<int32_t>(__get_cpuid_max(0, nullptr));
+		__cpuid(1, info[0], info[1], info[2], info[3]);
+#endif
+
+		const bool sse41   = (info[2] & (1 << 19)) != 0;
+		const bool osxsave = (info[2] & (1 << 27)) != 0;
+		const bool avx     = (info[2] & (1 << 28)) != 0;
+
+		if(!sse41)
+			return SimdLevel::Scalar;
+
+		if(!osxsave || !avx || maxLeaf < 7)
+			return SimdLevel::SSE41;
+
+		// The OS has to save the upper halves of the YMM registers
+#ifdef _MSC_VER
+		const uint64_t xcr0 = _xgetbv(0);
+		__cpuidex(info, 7, 0);
+#else
+		uint32_t eax = 0;
+		uint32_t edx = 0;
+		__asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+		const uint64_t xcr0 = (static_cast<uint64_t>(edx) << 32) | eax;
+
+		__cpuid_count(7, 0, info[0], info[1], info[2], info[3]);
+#endif
+
+		const bool avx2 = (info[1] & (1 << 5)) != 0;
+
+		return avx2 && (xcr0 & 0x6) == 0x6 ? SimdLevel::AVX2 : SimdLevel::SSE41;
+	}
+#else
+	static SimdLevel DetectSimdLevel()
+	{
+		return SimdLevel::Scalar;
+	}
+#endif
+
+	static constexpr std::string_view ToString(SimdLevel level)
+	{
+		switch(level)
+		{
+			case SimdLevel::Scalar:
+				return "Scalar";
+			case SimdLevel::SSE41:
+				return "SSE4.1";
+			case SimdLevel::AVX2:
+				return "AVX2";
+			default:
+				return "Unknown";
+		}
+	}
+
+	SimdLevel PixelConversion::GetSimdLevel()
+	{
+		if(!s_Detected)
+		{
+			s_Level    = GetSupportedSimdLevel();
+			s_Detected = true;
+
+			LOG_DEBUG("Pixel conversion uses {} kernels", ToString(s_Level));
+		}
+
+		return s_Level;
+	}
+
+	SimdLevel PixelConversion::GetSupportedSimdLevel()
+	{
+		static const SimdLevel s_Supported = DetectSimdLevel();
+		return s_Supported;
+	}
+
+	void PixelConversion::SetSimdLevel(SimdLevel level)
+	{
+		s_Level    = std::min(level, GetSupportedSimdLevel());
+		s_Detected = true;
+	}
+
+	void PixelConversion::SwizzleRedBlue(const uint8_t *source, uint8_t *destination, size_t pixels)
+	{
+		size_t done = 0;
+
+#ifdef GAME_PIXEL_SIMD
+		switch(GetSimdLevel())
+		{
+			case SimdLevel::AVX2:
+				done = SwizzleAVX2(source, destination, pixels);
+				break;
+			case SimdLevel::SSE41:
+				done = SwizzleSSE41(source, destination, pixels);
+				break;
+			default:
+				break;
+		}
+#endif
+
+		SwizzleScalar(source + done * 4, destination + done * 4, pixels - done);
+	}
+
+	void PixelConversion::FloatToUnorm8(const float *source, uint8_t *destination, size_t count)
+	{
+		size_t done = 0;
+
+#ifdef GAME_PIXEL_SIMD
+		switch(GetSimdLevel())
+		{
+			case SimdLevel::AVX2:
+				done = FloatToUnorm8AVX2(source, destination, count);
+				break;
+			case SimdLevel::SSE41:
+				done = FloatToUnorm8SSE41(source, destination, count);
+				break;
+			default:
+				break;
+		}
+#endif
+
+		FloatToUnorm8Scalar(source + done, destination + done, count - done);
+	}
+
+	void PixelConversion::Unorm8ToFloat(const uint8_t *source, float *destination, size_t count)
+	{
+		size_t done = 0;
+
+#ifdef GAME_PIXEL_SIMD
+		switch(GetSimdLevel())
+		{
+			case SimdLevel::AVX2:
+				done = Unorm8ToFloatAVX2(source, destination, count);
+				break;
+			case SimdLevel::SSE41:
+				done = Unorm8ToFloatSSE41(source, destination, count);
+				break;
+			default:
+				break;
+		}
+#endif
+
+		Unorm8ToFloatScalar(source + done, destination + done, count - done);
+	}
+
+	void PixelConversion::MultiplyAdd(const float *source, float weight, float *destination, size_t count)
+	{
+		size_t done = 0;
+
+#ifdef GAME_PIXEL_SIMD
+		switch(GetSimdLevel())
+		{
+			case SimdLevel::AVX2:
+				done = MultiplyAddAVX2(source, weight, destination, count);
+				break;
+			case SimdLevel::SSE41:
+				done = MultiplyAddSSE41(source, weight, destination, count);
+				break;
+			default:
+				break;
+		}
+#endif
+
+		MultiplyAddScalar(source + done, weight, destination + done, count - done);
+	}
+
+	void PixelConversion::FlipRows(const void *source, void *destination, size_t rowSize, size_t rows)
+	{
+		const auto input  = static_cast<const uint8_t*>(source);
+		const auto output = static_cast<uint8_t*>(destination);
+
+		if(input != output)
+		{
+			for(size_t i = 0; i < rows; ++i)
+				std::memcpy(output + (rows - 1 - i) * rowSize, input + i * rowSize, rowSize);
+
+			return;
+		}
+
+		for(size_t i = 0; i < rows / 2; ++i)
+			std::swap_ranges(output + i * rowSize, output + (i + 1) * rowSize, output + (rows - 1 - i) * rowSize);
+	}
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+
+namespace Game
+{
+	enum class SimdLevel
+	{
+		Scalar,
+		SSE41,
+		AVX2
+	};
+
+	class PixelConversion
+	{
+		static inline SimdLevel s_Level = SimdLevel::Scalar;
+		static inline bool s_Detected   = false;
+
+	public:
+		static SimdLevel GetSimdLevel();
+		static SimdLevel GetSupportedSimdLevel();
+
+		// Clamped to what the CPU supports, mainly useful for comparing kernels
+		static void SetSimdLevel(SimdLevel level);
+
+		// Swaps the red and blue channel of 8 bit four channel pixels, source and destination may alias
+		static void SwizzleRedBlue(const uint8_t *source, uint8_t *destination, size_t pixels);
+
+		static void FloatToUnorm8(const float *source, uint8_t *destination, size_t count);
+		static void Unorm8ToFloat(const uint8_t *source, float *destination, size_t count);
+
+		// destination += source * weight, used by the separable resampling filters
+		static void MultiplyAdd(const float *source, float weight, float *destination, size_t count);
+
+		// Source and destination may alias, in that case rows are swapped in place
+		static void FlipRows(const void *source, void *destination, size_t rowSize, size_t rows);
+	};
+}
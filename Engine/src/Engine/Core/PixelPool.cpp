@@ -0,0 +1,141 @@
+#include "pch.h"
+#include "PixelPool.h"
+
+#include <bit>
+#include <new>
+
+namespace Game
+{
+	void* PixelPool::Allocate(size_t size)
+	{
+		if(size == 0)
+			return nullptr;
+
+		const size_t index = GetClass(size);
+		if(index >= CLASS_COUNT)
+			return AllocateAligned(size);
+
+		{
+			std::scoped_lock lock(s_Mutex);
+
+			if(auto &free = s_Free[index]; !free.empty())
+			{
+				void *data = free.back();
+				free.pop_back();
+
+				s_CachedBytes -= GetClassSize(index);
+				return data;
+			}
+		}
+
+		return AllocateAligned(GetClassSize(index));
+	}
+
+	void PixelPool::Free(void *data, size_t size)
+	{
+		if(!data)
+			return;
+
+		const size_t index = GetClass(size);
+		if(index >= CLASS_COUNT)
+		{
+			FreeAligned(data);
+			return;
+		}
+
+		{
+			std::scoped_lock lock(s_Mutex);
+
+			if(s_CachedBytes + GetClassSize(index) <= s_CacheLimit)
+			{
+				s_Free[index].emplace_back(data);
+				s_CachedBytes += GetClassSize(index);
+
+				return;
+			}
+		}
+
+		FreeAligned(data);
+	}
+
+	size_t PixelPool::GetCapacity(size_t size)
+	{
+		if(size == 0)
+			return 0;
+
+		const size_t index = GetClass(size);
+		return index < CLASS_COUNT ? GetClassSize(index) : size;
+	}
+
+	void PixelPool::SetCacheLimit(size_t bytes)
+	{
+		{
+			std::scoped_lock lock(s_Mutex);
+			s_CacheLimit = bytes;
+		}
+
+		if(GetCachedBytes() > bytes)
+			Trim();
+	}
+
+	size_t PixelPool::GetCachedBytes()
+	{
+		std::scoped_lock lock(s_Mutex);
+		return s_CachedBytes;
+	}
+
+	void PixelPool::Trim()
+	{
+		std::array<std::vector<void*>, CLASS_COUNT> free;
+
+		{
+			std::scoped_lock lock(s_Mutex);
+
+			std::swap(free, s_Free);
+			s_CachedBytes = 0;
+		}
+
+		for(auto &buffers : free)
+		{
+			for(void *data : buffers)
+				FreeAligned(data);
+		}
+	}
+
+	// Classes grow in STEPS equal increments between powers of two, so at most a quarter of a buffer is wasted
+	size_t PixelPool::GetClass(size_t size)
+	{
+		if(size <= (1ull << MIN_CLASS_SHIFT))
+			return 0;
+
+		const size_t shift = std::bit_width(size - 1) - 1;
+		if(shift >= MAX_CLASS_SHIFT)
+			return CLASS_COUNT;
+
+		const size_t step = (1ull << shift) / STEPS;
+		const size_t sub  = (size - (1ull << shift) + step - 1) / step;
+
+		return (shift - MIN_CLASS_SHIFT) * STEPS + sub;
+	}
+
+	size_t PixelPool::GetClassSize(size_t index)
+	{
+		if(index == 0)
+			return 1ull << MIN_CLASS_SHIFT;
+
+		const size_t shift = (index - 1) / STEPS + MIN_CLASS_SHIFT;
+		const size_t sub   = (index - 1) % STEPS + 1;
+
+		return (1ull << shift) + sub * ((1ull << shift) / STEPS);
+	}
+
+	void* PixelPool::AllocateAligned(size_t size)
+	{
+		return ::operator new(size, std::align_val_t{ALIGNMENT});
+	}
+
+	void PixelPool::FreeAligned(void *data)
+	{
+		::operator delete(data, std::align_val_t{ALIGNMENT});
+	}
+}
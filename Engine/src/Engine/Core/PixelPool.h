@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+
+#include <array>
+#include <mutex>
+#include <vector>
+
+namespace Game
+{
+	// Size class allocator for pixel storage, every buffer is 64 byte aligned and freed buffers are kept for reuse
+	class PixelPool
+	{
+	public:
+		static constexpr size_t ALIGNMENT = 64;
+
+	private:
+		static constexpr size_t MIN_CLASS_SHIFT = 12;
+		static constexpr size_t MAX_CLASS_SHIFT = 30;
+		static constexpr size_t STEPS           = 4;
+		static constexpr size_t CLASS_COUNT     = (MAX_CLASS_SHIFT - MIN_CLASS_SHIFT) * STEPS + 1;
+
+		static inline std::mutex s_Mutex;
+		static inline std::array<std::vector<void*>, CLASS_COUNT> s_Free;
+
+		static inline size_t s_CachedBytes = 0;
+		static inline size_t s_CacheLimit  = 256 * 1024 * 1024;
+
+	public:
+		// The returned buffer holds at least GetCapacity(size) bytes
+		static void* Allocate(size_t size);
+		static void Free(void *data, size_t size);
+
+		static size_t GetCapacity(size_t size);
+
+		static void SetCacheLimit(size_t bytes);
+		static size_t GetCacheLimit() { return s_CacheLimit; }
+		static size_t GetCachedBytes();
+
+		static void Trim();
+
+	private:
+		static size_t GetClass(size_t size);
+		static size_t GetClassSize(size_t index);
+
+		static void* AllocateAligned(size_t size);
+		static void FreeAligned(void *data);
+	};
+}
@@ -0,0 +1,91 @@
+#include "pch.h"
+#include "Engine/Core/ThreadPool.h"
+
+namespace Game
+{
+	ThreadPool::ThreadPool(uint32_t threads)
+	{
+		// hardware_concurrency may report 0, one core stays with the main thread
+		if(threads == 0)
+			threads = std::max(2u, std::thread::hardware_concurrency()) - 1;
+
+		m_Workers.reserve(threads);
+		for(uint32_t i = 0; i < threads; ++i)
+			m_Workers.emplace_back([this]() { Run(); });
+
+		LOG_INFO("Started thread pool with {} workers", threads);
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::scoped_lock lock(m_Mutex);
+			m_Stop = true;
+		}
+
+		m_Condition.notify_all();
+
+		for(auto &worker : m_Workers)
+		{
+			if(worker.joinable())
+				worker.join();
+		}
+	}
+
+	void ThreadPool::Wait()
+	{
+		std::unique_lock lock(m_Mutex);
+		m_Idle.wait(lock, [this]() { return m_Tasks.empty() && m_Active == 0; });
+	}
+
+	size_t ThreadPool::Pending()
+	{
+		std::scoped_lock lock(m_Mutex);
+		return m_Tasks.size() + m_Active;
+	}
+
+	void ThreadPool::Enqueue(std::function<void()> task)
+	{
+		{
+			std::scoped_lock lock(m_Mutex);
+
+			ASSERT(!m_Stop, "Thread pool is stopped");
+			if(m_Stop)
+				throw std::runtime_error("Thread pool is stopped");
+
+			m_Tasks.emplace_back(std::move(task));
+		}
+
+		m_Condition.notify_one();
+	}
+
+	void ThreadPool::Run()
+	{
+		while(true)
+		{
+			std::function<void()> task;
+
+			{
+				std::unique_lock lock(m_Mutex);
+				m_Condition.wait(lock, [this]() { return m_Stop || !m_Tasks.empty(); });
+
+				if(m_Stop && m_Tasks.empty())
+					return;
+
+				task = std::move(m_Tasks.front());
+				m_Tasks.pop_front();
+				++m_Active;
+			}
+
+			task();
+
+			{
+				std::scoped_lock lock(m_Mutex);
+				--m_Active;
+
+				if(m_Tasks.empty() && m_Active == 0)
+					m_Idle.notify_all();
+			}
+		}
+	}
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Game
+{
+	class ThreadPool
+	{
+		std::vector<std::thread> m_Workers;
+		std::deque<std::function<void()>> m_Tasks;
+
+		std::mutex m_Mutex;
+		std::condition_variable m_Condition;
+		std::condition_variable m_Idle;
+
+		size_t m_Active = 0;
+		bool m_Stop     = false;
+
+	public:
+		explicit ThreadPool(uint32_t threads = 0);
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool(ThreadPool&&) = delete;
+
+		ThreadPool& operator=(const ThreadPool&) = delete;
+		ThreadPool& operator=(ThreadPool&&) = delete;
+
+		template <typename Func, typename... Args>
+		auto Submit(Func &&func, Args &&... args) -> std::future<std::invoke_result_t<Func, Args...>>
+		{
+			using ReturnType = std::invoke_result_t<Func, Args...>;
+
+			auto task = MakePointer<std::packaged_task<ReturnType()>>(
+			                                                          std::bind(std::forward<Func>(func), std::forward<Args>(args)...)
+			                                                         );
+			auto future = task->get_future();
+
+			Enqueue([task]() { (*task)(); });
+
+			return future;
+		}
+
+		void Wait();
+
+		size_t Size() const { return m_Workers.size(); }
+		size_t Pending();
+
+	private:
+		void Enqueue(std::function<void()> task);
+		void Run();
+	};
+}
@@ -4,77 +4,114 @@
 
 namespace Game
 {
+	// Nanosecond resolution, covers roughly 292 years either way
 	class Time
 	{
-		int64_t m_Microseconds = 0;
+		int64_t m_Nanoseconds = 0;
 
-		explicit Time(int64_t microseconds);
+		constexpr explicit Time(int64_t nanoseconds) : m_Nanoseconds(nanoseconds) {}
 
-		friend Time Seconds(const float);
-		friend Time Milliseconds(const int32_t);
-		friend Time Microseconds(const int64_t);
+		friend constexpr Time Seconds(const float);
+		friend constexpr Time Milliseconds(const int32_t);
+		friend constexpr Time Microseconds(const int64_t);
+		friend constexpr Time Nanoseconds(const int64_t);
 	public:
-		Time();
+		constexpr Time() = default;
 
-		float AsSeconds() const;
-		int32_t AsMilliseconds() const;
-		int64_t AsMicroseconds() const;
+		constexpr float AsSeconds() const { return static_cast<float>(static_cast<double>(m_Nanoseconds) / 1000000000.0); }
+		constexpr int32_t AsMilliseconds() const { return static_cast<int32_t>(m_Nanoseconds / 1000000); }
+		constexpr int64_t AsMicroseconds() const { return m_Nanoseconds / 1000; }
+		constexpr int64_t AsNanoseconds() const { return m_Nanoseconds; }
 
 		static const Time Zero;
 	};
 
-	Time Seconds(const float amount);
-	Time Milliseconds(const int32_t amount);
-	Time Microseconds(const int64_t amount);
-
-	bool operator==(const Time &left, const Time &right);
-	bool operator!=(const Time &left, const Time &right);
-	bool operator<(const Time &left, const Time &right);
-	bool operator>(const Time &left, const Time &right);
-	bool operator<=(const Time &left, const Time &right);
-	bool operator>=(const Time &left, const Time &right);
-
-	Time operator-(const Time& right);
-	Time operator-(const Time& left, const Time& right);
-	Time operator+(const Time& left, const Time& right);
-	
-	Time& operator-=(Time& left, const Time& right);
-	Time& operator+=(Time& left, const Time& right);
-	
-	Time operator*(const Time& left, const float& right);
-	Time operator*(const Time& left, const int64_t& right);
-	Time operator*(const float& left, const Time& right);
-	Time operator*(const int64_t& left, const Time& right);
-	
-	Time&operator*=(Time& left, const int64_t& right);
-	Time& operator*=(Time& left, const float& right);
-
-	Time operator/(const Time& left, const float& right);
-	Time operator/(const Time& left, const int64_t& right);
-	
-	Time& operator/=(Time& left, const float& right);
-	Time& operator/=(Time& left, const int64_t& right);
-
-	float operator/(const Time& left, const Time& right);
-	
-	Time operator%(const Time& left, const Time& right);
-	Time& operator%=(Time& left, const Time& right);
+	inline constexpr Time Time::Zero = Time();
+
+	constexpr Time Seconds(const float amount)
+	{
+		return Time(static_cast<int64_t>(static_cast<double>(amount) * 1000000000.0));
+	}
+
+	constexpr Time Milliseconds(const int32_t amount)
+	{
+		return Time(static_cast<int64_t>(amount) * 1000000);
+	}
+
+	constexpr Time Microseconds(const int64_t amount)
+	{
+		return Time(amount * 1000);
+	}
+
+	constexpr Time Nanoseconds(const int64_t amount)
+	{
+		return Time(amount);
+	}
+
+	constexpr bool operator==(const Time &left, const Time &right) { return left.AsNanoseconds() == right.AsNanoseconds(); }
+	constexpr bool operator!=(const Time &left, const Time &right) { return left.AsNanoseconds() != right.AsNanoseconds(); }
+	constexpr bool operator<(const Time &left, const Time &right) { return left.AsNanoseconds() < right.AsNanoseconds(); }
+	constexpr bool operator>(const Time &left, const Time &right) { return left.AsNanoseconds() > right.AsNanoseconds(); }
+	constexpr bool operator<=(const Time &left, const Time &right) { return left.AsNanoseconds() <= right.AsNanoseconds(); }
+	constexpr bool operator>=(const Time &left, const Time &right) { return left.AsNanoseconds() >= right.AsNanoseconds(); }
+
+	constexpr Time operator-(const Time &right) { return Nanoseconds(-right.AsNanoseconds()); }
+	constexpr Time operator-(const Time &left, const Time &right) { return Nanoseconds(left.AsNanoseconds() - right.AsNanoseconds()); }
+	constexpr Time operator+(const Time &left, const Time &right) { return Nanoseconds(left.AsNanoseconds() + right.AsNanoseconds()); }
+
+	constexpr Time& operator-=(Time &left, const Time &right) { return left = left - right; }
+	constexpr Time& operator+=(Time &left, const Time &right) { return left = left + right; }
+
+	constexpr Time operator*(const Time &left, const float &right)
+	{
+		return Nanoseconds(static_cast<int64_t>(static_cast<double>(left.AsNanoseconds()) * right));
+	}
+
+	constexpr Time operator*(const Time &left, const int64_t &right) { return Nanoseconds(left.AsNanoseconds() * right); }
+	constexpr Time operator*(const float &left, const Time &right) { return right * left; }
+	constexpr Time operator*(const int64_t &left, const Time &right) { return right * left; }
+
+	constexpr Time& operator*=(Time &left, const int64_t &right) { return left = left * right; }
+	constexpr Time& operator*=(Time &left, const float &right) { return left = left * right; }
+
+	constexpr Time operator/(const Time &left, const float &right)
+	{
+		return Nanoseconds(static_cast<int64_t>(static_cast<double>(left.AsNanoseconds()) / right));
+	}
+
+	constexpr Time operator/(const Time &left, const int64_t &right) { return Nanoseconds(left.AsNanoseconds() / right); }
+
+	constexpr Time& operator/=(Time &left, const float &right) { return left = left / right; }
+	constexpr Time& operator/=(Time &left, const int64_t &right) { return left = left / right; }
+
+	constexpr float operator/(const Time &left, const Time &right)
+	{
+		return static_cast<float>(static_cast<double>(left.AsNanoseconds()) / static_cast<double>(right.AsNanoseconds()));
+	}
+
+	constexpr Time operator%(const Time &left, const Time &right) { return Nanoseconds(left.AsNanoseconds() % right.AsNanoseconds()); }
+	constexpr Time& operator%=(Time &left, const Time &right) { return left = left % right; }
 
 	namespace Literals
 	{
-		inline Time operator"" _Sec(long double time)
+		constexpr Time operator"" _Sec(long double time)
 		{
-			return Seconds(static_cast<float>(time));
+			return Nanoseconds(static_cast<int64_t>(time * 1000000000.0L));
 		}
 
-		inline Time operator"" _Ms(unsigned long long time)
+		constexpr Time operator"" _Ms(unsigned long long time)
 		{
 			return Milliseconds(static_cast<int32_t>(time));
 		}
 
-		inline Time operator"" _Ns(unsigned long long time)
+		constexpr Time operator"" _Us(unsigned long long time)
 		{
 			return Microseconds(static_cast<int64_t>(time));
 		}
+
+		constexpr Time operator"" _Ns(unsigned long long time)
+		{
+			return Nanoseconds(static_cast<int64_t>(time));
+		}
 	}
 }
@@ -33,8 +33,18 @@ namespace Game
 	}
 
 	void Window::OnUpdate()
+	{
+		PollEvents();
+		SwapBuffers();
+	}
+
+	void Window::PollEvents()
 	{
 		glfwPollEvents();
+	}
+
+	void Window::SwapBuffers()
+	{
 		m_Context->SwapBuffers();
 	}
 
@@ -84,13 +94,30 @@ namespace Game
 	void Window::SetVSync(bool enabled)
 	{
 		if(enabled)
-			glfwSwapInterval(1);
+			glfwSwapInterval(m_Data.AdaptiveVSync ? -1 : 1);
 		else
 			glfwSwapInterval(0);
 
 		m_Data.VSync = enabled;
 	}
 
+	void Window::SetAdaptiveVSync(bool enabled)
+	{
+		if(enabled && !IsAdaptiveVSyncSupported())
+		{
+			LOG_WARN("Adaptive VSync is not supported, using regular VSync");
+			enabled = false;
+		}
+
+		m_Data.AdaptiveVSync = enabled;
+		SetVSync(m_Data.VSync);
+	}
+
+	bool Window::IsAdaptiveVSyncSupported()
+	{
+		return glfwExtensionSupported("WGL_EXT_swap_control_tear") || glfwExtensionSupported("GLX_EXT_swap_control_tear");
+	}
+
 	OpenGlFunctions Window::GetFunctions() const
 	{
 		return m_Context->GetFunctions();
@@ -239,7 +266,10 @@ namespace Game
 			InitializeGlfw();
 		}
 
+		glfwWindowHint(GLFW_VISIBLE, props.Visible ? GLFW_TRUE : GLFW_FALSE);
 		m_Window = glfwCreateWindow(static_cast<int>(props.Width), static_cast<int>(props.Height), m_Data.Title.c_str(), nullptr, nullptr);
+		glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+
 		++s_GLFWWindowCount;
 		m_Context = Context::Create(*this);
 		m_Monitor = MakeScope<Monitor>();
@@ -34,10 +34,12 @@ namespace Game
 		std::string Title;
 		uint32_t Width;
 		uint32_t Height;
+		bool Visible;
 
-		WindowProperties(const std::string title, uint32_t width, uint32_t height) : Title(title),
-		                                                                             Width(width),
-		                                                                             Height(height) { }
+		WindowProperties(const std::string title, uint32_t width, uint32_t height, bool visible = true) : Title(title),
+		                                                                                                  Width(width),
+		                                                                                                  Height(height),
+		                                                                                                  Visible(visible) { }
 	};
 
 	class Window
@@ -58,6 +60,7 @@ namespace Game
 			uint32_t Y = 0;
 
 			bool VSync = false;
+			bool AdaptiveVSync = false;
 			EventCallbackFunction EventCallback;
 		};
 
@@ -80,6 +83,9 @@ namespace Game
 
 		void OnUpdate();
 
+		void PollEvents();
+		void SwapBuffers();
+
 		void SetInputMode(bool enabled, InputMode mode);
 		bool GetInputMode(InputMode mode) const;
 		
@@ -101,6 +107,11 @@ namespace Game
 		void SetVSync(bool enabled);
 		bool IsVSync() const { return m_Data.VSync; };
 
+		// Late frames are swapped immediately instead of waiting for the next vertical blank, falls back to VSync when unsupported
+		void SetAdaptiveVSync(bool enabled);
+		bool IsAdaptiveVSync() const { return m_Data.AdaptiveVSync; }
+		static bool IsAdaptiveVSyncSupported();
+
 		void* GetNativeWindow() const { return m_Window; };
 
 		OpenGlFunctions GetFunctions() const;
@@ -0,0 +1,484 @@
+#include "pch.h"
+#include "Engine/Devices/InputRecorder.h"
+
+#include "Engine/Core/Application.h"
+#include "Engine/Core/Window.h"
+#include "Engine/Events/ApplicationEvent.h"
+#include "Engine/Events/KeyEvent.h"
+#include "Engine/Events/MouseEvent.h"
+
+#include <GLFW/glfw3.h>
+#include <cstring>
+#include <iterator>
+
+namespace
+{
+	constexpr char MAGIC[4]    = {'I', 'N', 'P', 'R'};
+	constexpr uint32_t VERSION = 1;
+
+	constexpr size_t FLUSH_SIZE = 64 * 1024;
+
+	// Tick records carry the device state only when it changed since the previous one
+	constexpr uint8_t STATE_UNCHANGED = 0;
+	constexpr uint8_t STATE_CHANGED   = 1;
+}
+
+namespace Game
+{
+	bool InputRecorder::StartRecording(const std::filesystem::path &path)
+	{
+		Stop();
+
+		s_File.open(path, std::ios::binary | std::ios::trunc);
+
+		if(!s_File.is_open())
+		{
+			LOG_ERROR("Unable to open input recording: {}", path.string());
+			return false;
+		}
+
+		s_Path     = path;
+		s_Tick     = 0;
+		s_Finished = false;
+		s_State    = {};
+		s_Recorded = {};
+
+		s_Buffer.clear();
+		Write(MAGIC);
+		Write(VERSION);
+
+		s_Mode = Mode::Recording;
+
+		LOG_INFO("Recording input to {}", path.string());
+		return true;
+	}
+
+	bool InputRecorder::StartReplay(const std::filesystem::path &path, EventCallback callback)
+	{
+		ASSERT(callback, "Input replay requires an event callback");
+		if(!callback)
+			throw std::invalid_argument("Input replay requires an event callback");
+
+		Stop();
+
+		std::ifstream file(path, std::ios::binary);
+
+		if(!file.is_open())
+		{
+			LOG_ERROR("Unable to open input recording: {}", path.string());
+			return false;
+		}
+
+		// The whole log is read up front, replaying never touches the disk
+		s_Buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+		s_Offset = 0;
+
+		char magic[4];
+		uint32_t version = 0;
+
+		if(!Read(magic) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 || !Read(version) || version != VERSION)
+		{
+			LOG_ERROR("{} is not an input recording of version {}", path.string(), VERSION);
+			s_Buffer.clear();
+			return false;
+		}
+
+		s_Path     = path;
+		s_Tick     = 0;
+		s_Finished = false;
+		s_State    = {};
+		s_Callback = std::move(callback);
+		s_Mode     = Mode::Replaying;
+
+		LOG_INFO("Replaying input from {}", path.string());
+		return true;
+	}
+
+	void InputRecorder::Stop()
+	{
+		if(s_Mode == Mode::Recording)
+		{
+			Flush();
+			s_File.close();
+
+			LOG_INFO("Recorded {} input ticks to {}", s_Tick, s_Path.string());
+		}
+		else if(s_Mode == Mode::Replaying && !s_Finished)
+			LOG_INFO("Input replay stopped after {} ticks", s_Tick);
+
+		s_Mode = Mode::Idle;
+
+		s_Buffer.clear();
+		s_Buffer.shrink_to_fit();
+		s_Offset   = 0;
+		s_Callback = nullptr;
+	}
+
+	bool InputRecorder::OnEvent(Event &event)
+	{
+		if(s_Mode == Mode::Idle || !IsRecorded(event))
+			return true;
+
+		// The replay dispatches its own copies of recorded events, live ones would resize or refocus twice. Closing the
+		// window still has to work
+		if(s_Mode == Mode::Replaying)
+			return s_Replaying || event.GetEventType() == EventType::WindowClose;
+
+		switch(event.GetEventType())
+		{
+			case EventType::KeyPressed:
+			{
+				const auto &key = static_cast<KeyPressedEvent&>(event);
+
+				Write(key.IsRepeat() ? Record::KeyRepeated : Record::KeyPressed);
+				Write(key.GetKeyCode());
+
+				if(key.GetKeyCode() < s_State.Keys.size())
+					s_State.Keys.set(key.GetKeyCode());
+				break;
+			}
+			case EventType::KeyReleased:
+			{
+				const auto &key = static_cast<KeyReleasedEvent&>(event);
+
+				Write(Record::KeyReleased);
+				Write(key.GetKeyCode());
+
+				if(key.GetKeyCode() < s_State.Keys.size())
+					s_State.Keys.reset(key.GetKeyCode());
+				break;
+			}
+			case EventType::KeyTyped:
+				Write(Record::KeyTyped);
+				Write(static_cast<KeyTypedEvent&>(event).GetKeyCode());
+				break;
+			case EventType::MouseButtonPressed:
+			{
+				const auto button = static_cast<MouseButtonPressedEvent&>(event).GetMouseButton();
+
+				Write(Record::MouseButtonPressed);
+				Write(button);
+
+				if(button <= Mouse::ButtonLast)
+					s_State.Buttons |= static_cast<uint8_t>(BIT(button));
+				break;
+			}
+			case EventType::MouseButtonReleased:
+			{
+				const auto button = static_cast<MouseButtonReleasedEvent&>(event).GetMouseButton();
+
+				Write(Record::MouseButtonReleased);
+				Write(button);
+
+				if(button <= Mouse::ButtonLast)
+					s_State.Buttons &= static_cast<uint8_t>(~BIT(button));
+				break;
+			}
+			case EventType::MouseMoved:
+			{
+				const auto &moved = static_cast<MouseMovedEvent&>(event);
+
+				Write(Record::MouseMoved);
+				Write(moved.GetX());
+				Write(moved.GetY());
+
+				s_State.Position = Vector2i(static_cast<int32_t>(moved.GetX()), static_cast<int32_t>(moved.GetY()));
+				break;
+			}
+			case EventType::MouseScrolled:
+			{
+				const auto &scrolled = static_cast<MouseScrolledEvent&>(event);
+
+				Write(Record::MouseScrolled);
+				Write(scrolled.GetXOffset());
+				Write(scrolled.GetYOffset());
+				break;
+			}
+			case EventType::WindowResize:
+			{
+				const auto &resize = static_cast<WindowResizeEvent&>(event);
+
+				Write(Record::WindowResize);
+				Write(resize.GetWidth());
+				Write(resize.GetHeight());
+				break;
+			}
+			case EventType::WindowFocus:
+				Write(Record::WindowFocus);
+				break;
+			case EventType::WindowLostFocus:
+				Write(Record::WindowLostFocus);
+				break;
+			case EventType::WindowClose:
+				Write(Record::WindowClose);
+				break;
+			default:
+				break;
+		}
+
+		return true;
+	}
+
+	void InputRecorder::Tick()
+	{
+		if(s_Mode == Mode::Recording)
+		{
+			Sample();
+
+			Write(Record::Tick);
+
+			if(s_State != s_Recorded)
+			{
+				Write(STATE_CHANGED);
+				Write(s_State.Buttons);
+				Write(s_State.Position.X);
+				Write(s_State.Position.Y);
+				Write(static_cast<uint16_t>(s_State.Keys.count()));
+
+				for(KeyCode key = 0; key < s_State.Keys.size(); ++key)
+				{
+					if(s_State.Keys.test(key))
+						Write(key);
+				}
+
+				s_Recorded = s_State;
+			}
+			else
+				Write(STATE_UNCHANGED);
+
+			if(s_Buffer.size() >= FLUSH_SIZE)
+				Flush();
+
+			++s_Tick;
+		}
+		else if(s_Mode == Mode::Replaying)
+		{
+			Record record;
+
+			while(Read(record))
+			{
+				if(record == Record::Tick)
+				{
+					if(!ReadState())
+						break;
+
+					++s_Tick;
+					return;
+				}
+
+				if(!Dispatch(record))
+					break;
+			}
+
+			if(s_Offset != s_Buffer.size())
+				LOG_WARN("Input recording {} is damaged after tick {}", s_Path.string(), s_Tick);
+
+			LOG_INFO("Input replay finished after {} ticks", s_Tick);
+
+			s_Finished = true;
+			Stop();
+		}
+	}
+
+	bool InputRecorder::IsKeyPressed(KeyCode key)
+	{
+		return key < s_State.Keys.size() && s_State.Keys.test(key);
+	}
+
+	bool InputRecorder::IsButtonPressed(Mouse::CodeType button)
+	{
+		return button <= Mouse::ButtonLast && (s_State.Buttons & BIT(button)) != 0;
+	}
+
+	bool InputRecorder::IsRecorded(const Event &event)
+	{
+		switch(event.GetEventType())
+		{
+			case EventType::WindowResize:
+			case EventType::WindowFocus:
+			case EventType::WindowLostFocus:
+			case EventType::WindowClose:
+				return true;
+			default:
+				return event.IsInCategory(EventCategoryInput);
+		}
+	}
+
+	// Without a window the state is whatever the recorded events left behind
+	void InputRecorder::Sample()
+	{
+		auto &application = Application::Get();
+
+		if(!application.HasWindow())
+			return;
+
+		const auto window = static_cast<GLFWwindow*>(application.GetWindow().GetNativeWindow());
+
+		for(KeyCode key = Key::Space; key <= Key::Menu; ++key)
+			s_State.Keys.set(key, glfwGetKey(window, key) == GLFW_PRESS);
+
+		s_State.Buttons = 0;
+		for(int button = Mouse::Button0; button <= Mouse::ButtonLast; ++button)
+		{
+			if(glfwGetMouseButton(window, button) == GLFW_PRESS)
+				s_State.Buttons |= static_cast<uint8_t>(BIT(button));
+		}
+
+		double x, y;
+		glfwGetCursorPos(window, &x, &y);
+
+		s_State.Position = Vector2i(static_cast<int32_t>(x), static_cast<int32_t>(y));
+	}
+
+	void InputRecorder::Flush()
+	{
+		if(s_Buffer.empty())
+			return;
+
+		s_File.write(reinterpret_cast<const char*>(s_Buffer.data()), static_cast<std::streamsize>(s_Buffer.size()));
+		s_Buffer.clear();
+	}
+
+	template <typename Type>
+	void InputRecorder::Write(const Type &value)
+	{
+		const auto bytes = reinterpret_cast<const uint8_t*>(&value);
+		s_Buffer.insert(s_Buffer.end(), bytes, bytes + sizeof(Type));
+	}
+
+	template <typename Type>
+	bool InputRecorder::Read(Type &value)
+	{
+		if(s_Buffer.size() - s_Offset < sizeof(Type))
+			return false;
+
+		std::memcpy(&value, s_Buffer.data() + s_Offset, sizeof(Type));
+		s_Offset += sizeof(Type);
+
+		return true;
+	}
+
+	bool InputRecorder::ReadState()
+	{
+		uint8_t changed;
+		if(!Read(changed))
+			return false;
+
+		if(changed == STATE_UNCHANGED)
+			return true;
+
+		State state{};
+		uint16_t count = 0;
+
+		if(!Read(state.Buttons) || !Read(state.Position.X) || !Read(state.Position.Y) || !Read(count))
+			return false;
+
+		for(uint16_t i = 0; i < count; ++i)
+		{
+			KeyCode key;
+			if(!Read(key) || key >= state.Keys.size())
+				return false;
+
+			state.Keys.set(key);
+		}
+
+		s_State = state;
+		return true;
+	}
+
+	bool InputRecorder::Dispatch(Record record)
+	{
+		KeyCode key;
+		Mouse::CodeType button;
+		float x, y;
+		uint32_t width, height;
+
+		bool valid = true;
+		s_Replaying = true;
+
+		switch(record)
+		{
+			case Record::KeyPressed:
+			case Record::KeyRepeated:
+				if((valid = Read(key)))
+				{
+					KeyPressedEvent event(key, record == Record::KeyRepeated);
+					s_Callback(event);
+				}
+				break;
+			case Record::KeyReleased:
+				if((valid = Read(key)))
+				{
+					KeyReleasedEvent event(key);
+					s_Callback(event);
+				}
+				break;
+			case Record::KeyTyped:
+				if((valid = Read(key)))
+				{
+					KeyTypedEvent event(key);
+					s_Callback(event);
+				}
+				break;
+			case Record::MouseButtonPressed:
+				if((valid = Read(button)))
+				{
+					MouseButtonPressedEvent event(button);
+					s_Callback(event);
+				}
+				break;
+			case Record::MouseButtonReleased:
+				if((valid = Read(button)))
+				{
+					MouseButtonReleasedEvent event(button);
+					s_Callback(event);
+				}
+				break;
+			case Record::MouseMoved:
+				if((valid = Read(x) && Read(y)))
+				{
+					MouseMovedEvent event(x, y);
+					s_Callback(event);
+				}
+				break;
+			case Record::MouseScrolled:
+				if((valid = Read(x) && Read(y)))
+				{
+					MouseScrolledEvent event(x, y);
+					s_Callback(event);
+				}
+				break;
+			case Record::WindowResize:
+				if((valid = Read(width) && Read(height)))
+				{
+					WindowResizeEvent event(width, height);
+					s_Callback(event);
+				}
+				break;
+			case Record::WindowFocus:
+			{
+				WindowGainFocusEvent event;
+				s_Callback(event);
+				break;
+			}
+			case Record::WindowLostFocus:
+			{
+				WindowLostFocusEvent event;
+				s_Callback(event);
+				break;
+			}
+			case Record::WindowClose:
+			{
+				WindowCloseEvent event;
+				s_Callback(event);
+				break;
+			}
+			default:
+				valid = false;
+				break;
+		}
+
+		s_Replaying = false;
+		return valid;
+	}
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/Core/KeyCodes.h"
+#include "Engine/Core/Vector2.h"
+#include "Engine/Devices/Mouse.h"
+
+#include <bitset>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <vector>
+
+namespace Game
+{
+	class Event;
+
+	// Captures the input event stream and the polled device state once per fixed update tick, a replay feeds both back
+	// at the same ticks while live input from GLFW is ignored
+	class InputRecorder
+	{
+	public:
+		using EventCallback = std::function<void(Event&)>;
+
+		enum class Mode
+		{
+			Idle,
+			Recording,
+			Replaying
+		};
+
+	private:
+		enum class Record : uint8_t
+		{
+			Tick,
+			KeyPressed,
+			KeyRepeated,
+			KeyReleased,
+			KeyTyped,
+			MouseButtonPressed,
+			MouseButtonReleased,
+			MouseMoved,
+			MouseScrolled,
+			WindowResize,
+			WindowFocus,
+			WindowLostFocus,
+			WindowClose
+		};
+
+		struct State
+		{
+			std::bitset<Key::Menu + 1> Keys;
+			uint8_t Buttons;
+			Vector2i Position;
+
+			bool operator==(const State &other) const { return Keys == other.Keys && Buttons == other.Buttons && Position == other.Position; }
+			bool operator!=(const State &other) const { return !(*this == other); }
+		};
+
+		static inline Mode s_Mode      = Mode::Idle;
+		static inline bool s_Finished  = false;
+		static inline bool s_Replaying = false;
+
+		static inline std::filesystem::path s_Path;
+		static inline std::ofstream s_File;
+		static inline std::vector<uint8_t> s_Buffer;
+		static inline size_t s_Offset = 0;
+		static inline uint64_t s_Tick = 0;
+
+		static inline State s_State{};
+		static inline State s_Recorded{};
+		static inline EventCallback s_Callback;
+
+	public:
+		static bool StartRecording(const std::filesystem::path &path);
+		static bool StartReplay(const std::filesystem::path &path, EventCallback callback);
+
+		// Writes out a recording, or abandons a replay
+		static void Stop();
+
+		static Mode GetMode() { return s_Mode; }
+		static bool IsRecording() { return s_Mode == Mode::Recording; }
+		static bool IsReplaying() { return s_Mode == Mode::Replaying; }
+
+		// Set once a replay ran out of input
+		static bool HasFinished() { return s_Finished; }
+		static uint64_t GetTick() { return s_Tick; }
+
+		// Every event passes through here first, returns false for live input a running replay stands in for
+		static bool OnEvent(Event &event);
+
+		// Called before every fixed update
+		static void Tick();
+
+		// Polled state during a replay
+		static bool IsKeyPressed(KeyCode key);
+		static bool IsButtonPressed(Mouse::CodeType button);
+		static Vector2i GetMousePosition() { return s_State.Position; }
+
+	private:
+		static bool IsRecorded(const Event &event);
+
+		static void Sample();
+		static void Flush();
+
+		template <typename Type>
+		static void Write(const Type &value);
+
+		template <typename Type>
+		static bool Read(Type &value);
+
+		static bool ReadState();
+		static bool Dispatch(Record record);
+	};
+}
@@ -3,6 +3,7 @@
 
 #include "Engine/Core/Window.h"
 #include "Engine/Core/Application.h"
+#include "Engine/Devices/InputRecorder.h"
 #include "Engine/Utils/LuaUtils.h"
 
 #include <Windows.h>
@@ -143,6 +144,10 @@ namespace
 	{
 		key = std::clamp(key, static_cast<int>(std::numeric_limits<Game::KeyCode>::min()), static_cast<int>(std::numeric_limits<Game::KeyCode>::max()));
 
+		// Headless runs have no window, a replay is the only input they get
+		if(!Game::Application::Get().HasWindow())
+			return Game::InputRecorder::IsReplaying() && Game::InputRecorder::IsKeyPressed(static_cast<Game::KeyCode>(key));
+
 		return Game::Keyboard::IsKeyPressed(static_cast<Game::KeyCode>(key), Game::Application::Get().GetWindow());
 	}
 
@@ -285,11 +290,17 @@ namespace Game
 {
 	bool Keyboard::IsKeyPressed(KeyCode key)
 	{
+		if(InputRecorder::IsReplaying())
+			return InputRecorder::IsKeyPressed(key);
+
 		return (GetAsyncKeyState(ToWinKey(key)) & 0x8000) != 0;
 	}
 
 	bool Keyboard::IsKeyPressed(KeyCode key, const Window &window)
 	{
+		if(InputRecorder::IsReplaying())
+			return InputRecorder::IsKeyPressed(key);
+
 		return glfwGetKey(static_cast<GLFWwindow*>(window.GetNativeWindow()), key) == GLFW_PRESS;
 	}
 
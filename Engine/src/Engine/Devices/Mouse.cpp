@@ -3,6 +3,7 @@
 
 #include "Engine/Core/Window.h"
 #include "Engine/Core/Application.h"
+#include "Engine/Devices/InputRecorder.h"
 #include "Engine/Utils/LuaUtils.h"
 
 #include <Windows.h>
@@ -24,11 +25,24 @@ namespace
 			LOG_WARN("Given button does not exits replaced with Button7");
 		}
 
+		// Headless runs have no window, a replay is the only input they get
+		if(!Game::Application::Get().HasWindow())
+			return Game::InputRecorder::IsReplaying() && Game::InputRecorder::IsButtonPressed(button);
+
 		return Game::Mouse::IsButtonPressed(button, Game::Application::Get().GetWindow());
 	}
 
 	std::pair<int32_t, int32_t> GetMousePosition()
 	{
+		if(!Game::Application::Get().HasWindow())
+		{
+			if(!Game::InputRecorder::IsReplaying())
+				return std::make_pair(0, 0);
+
+			const auto pos = Game::InputRecorder::GetMousePosition();
+			return std::make_pair(pos.X, pos.Y);
+		}
+
 		const auto pos = Game::Mouse::GetPosition(Game::Application::Get().GetWindow());
 		return std::make_pair(pos.X, pos.Y);
 	}
@@ -41,6 +55,9 @@ namespace
 
 	void SetMousePosition(int x, int y)
 	{
+		if(!Game::Application::Get().HasWindow())
+			return;
+
 		Game::Mouse::SetPosition(x, y, Game::Application::Get().GetWindow());
 	}
 
@@ -54,6 +71,9 @@ namespace Game
 {
 	bool Mouse::IsButtonPressed(CodeType button)
 	{
+		if(InputRecorder::IsReplaying())
+			return InputRecorder::IsButtonPressed(button);
+
 		int vKey = 0;
 
 		switch(button)
@@ -77,11 +97,17 @@ namespace Game
 
 	bool Mouse::IsButtonPressed(CodeType button, const Window &relative)
 	{
+		if(InputRecorder::IsReplaying())
+			return InputRecorder::IsButtonPressed(button);
+
 		return glfwGetMouseButton(static_cast<GLFWwindow*>(relative.GetNativeWindow()), button) == GLFW_PRESS;
 	}
 
 	Vector2i Mouse::GetPosition()
 	{
+		if(InputRecorder::IsReplaying())
+			return InputRecorder::GetMousePosition();
+
 		POINT point;
 		GetCursorPos(&point);
 
@@ -90,6 +116,9 @@ namespace Game
 
 	Vector2i Mouse::GetPosition(const Window &relative)
 	{
+		if(InputRecorder::IsReplaying())
+			return InputRecorder::GetMousePosition();
+
 		const auto window = static_cast<GLFWwindow*>(relative.GetNativeWindow());
 
 		double x, y;
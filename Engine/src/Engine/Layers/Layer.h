@@ -20,7 +20,8 @@ namespace Game
 
 		virtual void OnAttach() {}
 		virtual void OnDetach() {}
-		virtual void OnUpdate() {}
+		// alpha is how far the frame is between the last two fixed updates, in [0, 1)
+		virtual void OnUpdate(float alpha) {}
 		virtual void OnConstUpdate(const Time& timeStep) {}
 		virtual void OnImGuiRender() {}
 		virtual void OnEvent(Event& event) {}
@@ -4,6 +4,7 @@
 #include "Engine/Layers/Layer.h"
 
 #include "Engine/Core/Clock.h"
+#include "Engine/OpenGL/ShaderProgram.h"
 
 namespace Game
 {
@@ -15,6 +16,8 @@ namespace Game
 
 		uint64_t m_Updates = 0;
 		uint64_t m_LastUpdates = 0;
+
+		ShaderProgram::UploadStatistics m_UniformUploads;
 		
 		Clock m_Clock;
 
@@ -25,9 +28,12 @@ namespace Game
 		virtual void OnConstUpdate(const Time& ts) override;
 		virtual void OnImGuiRender() override;
 
-		virtual void OnUpdate() override;
+		virtual void OnUpdate(float alpha) override;
 
 		void IsVisible(bool visible) { m_Show = visible; }
 		bool IsVisible() const { return m_Show; }
+
+	private:
+		void DrawZones() const;
 	};
 }
\ No newline at end of file
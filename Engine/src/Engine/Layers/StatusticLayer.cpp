@@ -9,6 +9,8 @@
 #include "Engine/ImGui/ImGuiGuard.h"
 #include "Engine/ImGUi/ImGuiUtils.h"
 
+#include "Engine/Renderer/GpuProfiler.h"
+
 #include <algorithm>
 #include <imgui.h>
 #include <float.h>
@@ -82,6 +84,7 @@ namespace Game
 	{
 		Application::Get().RegisterShortcut(Shortcut([this]() { m_Show = !m_Show; }, Key::F, Key::LeftControl));
 		Application::Get().RegisterShortcut(Shortcut([this]() { m_Show = !m_Show; }, Key::F, Key::RightControl));
+		Application::Get().RegisterShortcut(Shortcut([]() { GpuProfiler::SaveTrace("Trace.json"); }, Key::P, Key::LeftControl));
 		// Application::Get().RegisterShortcut(Shortcut([this](){m_ShowMetric = !m_ShowMetric}, Key::))
 	}
 
@@ -118,17 +121,58 @@ namespace Game
 		Text("Fps: {:.2f}", 1.f / game.GetFrameTime().AsSeconds());
 		Text("Ups: {:.2f}", 1.f / m_LastUpdates);
 		Text("Frame Time: {}ms", game.GetFrameTime().AsMilliseconds());
+		Text("Pacing wait: {}us (GPU: {}us)", game.GetFramePacer().GetWaitTime().AsMicroseconds(), game.GetFramePacer().GetFenceWaitTime().AsMicroseconds());
 		Text("Elapsed Time: {:.2f}s", game.GetElapsedTime().AsSeconds());
 		Text("Updates: {}", m_LastUpdates);
+		Text("Dropped updates: {} ({}ms)", game.GetScheduler().GetDroppedSteps(game.GetUpdateChannel()), game.GetScheduler().GetDroppedTime(game.GetUpdateChannel()).AsMilliseconds());
 		Text("Mouse Position: {}, {}", mousePos.X, mousePos.Y);
 		Text("Window Position: {}, {}", windowPos.X, windowPos.Y);
 		Text("Window size {}x{}", windowSize.Width, windowSize.Height);
+		Text("Uniform uploads: {} (elided: {})", m_UniformUploads.Issued, m_UniformUploads.Elided);
 
 		s_FpsStat.Draw("Fps");
+
+		DrawZones();
 	}
 
-	void StatisticLayer::OnUpdate()
+	void StatisticLayer::DrawZones() const
 	{
+		const auto frame = GpuProfiler::GetLastFrame();
+		if(!frame)
+			return;
+
+		if(!ImGui::BeginTable("Zones", 3, ImGuiTableFlags_RowBg))
+			return;
+
+		ImGui::TableSetupColumn("Zone");
+		ImGui::TableSetupColumn("CPU");
+		ImGui::TableSetupColumn("GPU");
+		ImGui::TableHeadersRow();
+
+		for(const auto &zone : frame->Zones)
+		{
+			ImGui::TableNextRow();
+
+			ImGui::TableNextColumn();
+			ImGui::Indent(static_cast<float>(zone.Depth) * ImGui::GetStyle().IndentSpacing + 1.f);
+			Text("{}", zone.Name);
+			ImGui::Unindent(static_cast<float>(zone.Depth) * ImGui::GetStyle().IndentSpacing + 1.f);
+
+			ImGui::TableNextColumn();
+			Text("{:.3f}ms", static_cast<double>(zone.CpuTime.AsNanoseconds()) / 1000000.0);
+
+			ImGui::TableNextColumn();
+			Text("{:.3f}ms", static_cast<double>(zone.GpuTime.AsNanoseconds()) / 1000000.0);
+		}
+
+		ImGui::EndTable();
+	}
+
+	void StatisticLayer::OnUpdate(float alpha)
+	{
+		m_UniformUploads = ShaderProgram::GetUploadStatistics();
+		ShaderProgram::ResetUploadStatistics();
+
 		// if(Keyboard::IsKeyPressed(Key::F) && (Keyboard::IsKeyPressed(Key::LeftControl) || Keyboard::IsKeyPressed(Key::RightControl)))
 		// {
 		// 	if(!m_Processed)
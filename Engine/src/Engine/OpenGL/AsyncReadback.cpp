@@ -0,0 +1,177 @@
+#include "pch.h"
+#include "Engine/OpenGL/AsyncReadback.h"
+
+#include "Engine/OpenGL/FrameBuffer.h"
+#include "Engine/OpenGL/TextureObject.h"
+#include "Engine/Renderer/Context.h"
+
+namespace Game
+{
+	AsyncReadback::AsyncReadback(uint32_t slots)
+	{
+		ASSERT(slots > 0, "Readback needs at least one slot");
+		if(slots == 0)
+			throw std::invalid_argument("Readback needs at least one slot");
+
+		m_Slots.resize(slots);
+	}
+
+	AsyncReadback::~AsyncReadback()
+	{
+		if(const size_t pending = Pending(); pending > 0)
+			GL_LOG_DEBUG("Dropping {} pending readbacks", pending);
+	}
+
+	bool AsyncReadback::Read(const FrameBufferObject &frameBuffer, const UIntRect &rect, Callback callback, uint32_t attachment)
+	{
+		ASSERT(rect.Width > 0 && rect.Height > 0, "Empty readback rectangle");
+		if(rect.Width == 0 || rect.Height == 0)
+			throw std::invalid_argument("Empty readback rectangle");
+
+		auto slot = Acquire({rect.Width, rect.Height});
+		if(!slot)
+			return false;
+
+		auto functions = Context::GetContext()->GetFunctions();
+
+		const auto previous = static_cast<uint32_t>(functions.GetInteger(GL_READ_FRAMEBUFFER_BINDING));
+
+		// The read buffer is framebuffer state, whoever reads from it next expects their own selection
+		functions.BindFrameBuffer(frameBuffer.ID(), true);
+		const auto readBuffer = static_cast<uint32_t>(functions.GetInteger(GL_READ_BUFFER));
+
+		functions.FrameBufferReadBuffer(frameBuffer.ID(), frameBuffer.ID() == 0 ? GL_BACK : GL_COLOR_ATTACHMENT0 + attachment);
+
+		slot->Buffer->Bind();
+		functions.ReadPixels(
+		                     static_cast<int32_t>(rect.X),
+		                     static_cast<int32_t>(rect.Y),
+		                     rect.Width,
+		                     rect.Height,
+		                     Format::Rgba,
+		                     DataType::UnsignedByte,
+		                     nullptr
+		                    );
+		slot->Buffer->UnBind();
+
+		functions.FrameBufferReadBuffer(frameBuffer.ID(), readBuffer);
+		functions.BindFrameBuffer(previous, true);
+
+		Submit(*slot, std::move(callback));
+		return true;
+	}
+
+	bool AsyncReadback::Read(const TextureObject &texture, Callback callback, uint32_t level)
+	{
+		ASSERT(level < texture.Levels(), "Level out of range");
+		if(level >= texture.Levels())
+			throw std::out_of_range("Level out of range");
+
+		const auto size = texture.GetLevelSize(level);
+
+		auto slot = Acquire(size);
+		if(!slot)
+			return false;
+
+		const auto functions = Context::GetContext()->GetFunctions();
+
+		slot->Buffer->Bind();
+		functions.GetTextureImage(
+		                          texture.ID(),
+		                          static_cast<int32_t>(level),
+		                          Format::Rgba,
+		                          DataType::UnsignedByte,
+		                          static_cast<uint32_t>(static_cast<size_t>(size.Width) * size.Height * sizeof(Color)),
+		                          nullptr
+		                         );
+		slot->Buffer->UnBind();
+
+		Submit(*slot, std::move(callback));
+		return true;
+	}
+
+	void AsyncReadback::Update()
+	{
+		while(m_Slots[m_Oldest].Busy && m_Slots[m_Oldest].InFlight.IsSignaled())
+			Complete(m_Slots[m_Oldest]);
+	}
+
+	void AsyncReadback::Flush()
+	{
+		while(m_Slots[m_Oldest].Busy)
+		{
+			m_Slots[m_Oldest].InFlight.Wait(std::numeric_limits<uint64_t>::max());
+			Complete(m_Slots[m_Oldest]);
+		}
+	}
+
+	size_t AsyncReadback::Pending() const
+	{
+		return static_cast<size_t>(std::ranges::count_if(m_Slots, [](const Slot &slot) { return slot.Busy; }));
+	}
+
+	AsyncReadback::Slot* AsyncReadback::Acquire(const Vector2u &size)
+	{
+		auto &slot = m_Slots[m_Next];
+
+		// The ring is full, the oldest request can only be reused once the GPU has written it
+		if(slot.Busy)
+		{
+			if(!slot.InFlight.IsSignaled())
+			{
+				GL_LOG_TRACE("Readback ring is full, dropping request");
+				return nullptr;
+			}
+
+			Complete(slot);
+		}
+
+		const size_t bytes = static_cast<size_t>(size.Width) * size.Height * sizeof(Color);
+
+		if(!slot.Buffer)
+			slot.Buffer = MakeScope<PixelBuffer>(bytes, BufferType::PixelPack, BufferUsage::StreamRead);
+		else if(slot.Buffer->Size() < bytes)
+			slot.Buffer->Realloc(bytes, BufferUsage::StreamRead);
+
+		slot.Size = size;
+		return &slot;
+	}
+
+	void AsyncReadback::Submit(Slot &slot, Callback callback)
+	{
+		slot.InFlight   = Fence(true);
+		slot.OnComplete = std::move(callback);
+		slot.Busy       = true;
+
+		m_Next = (m_Next + 1) % static_cast<uint32_t>(m_Slots.size());
+	}
+
+	void AsyncReadback::Complete(Slot &slot)
+	{
+		const void *data = slot.Buffer->Map(BufferAccess::ReadOnly);
+
+		if(data)
+		{
+			slot.Pixels.Resize(slot.Size);
+			std::memcpy(slot.Pixels.begin(), data, static_cast<size_t>(slot.Size.Width) * slot.Size.Height * sizeof(Color));
+		}
+
+		slot.Buffer->UnMap();
+		slot.InFlight.Reset();
+		slot.Busy = false;
+
+		m_Oldest = (m_Oldest + 1) % static_cast<uint32_t>(m_Slots.size());
+
+		const auto callback = std::move(slot.OnComplete);
+		slot.OnComplete     = nullptr;
+
+		if(!data)
+		{
+			GL_LOG_ERROR("Unable to map readback buffer");
+			return;
+		}
+
+		if(callback)
+			callback(slot.Pixels);
+	}
+}
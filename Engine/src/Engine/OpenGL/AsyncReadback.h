@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/Core/Image.h"
+#include "Engine/Core/Rect.h"
+#include "Engine/OpenGL/Fence.h"
+#include "Engine/OpenGL/PixelBuffer.h"
+
+#include <functional>
+#include <vector>
+
+namespace Game
+{
+	class FrameBufferObject;
+	class TextureObject;
+
+	// Copies pixels into a ring of pixel pack buffers and hands them back a few frames later, once the GPU is done,
+	// so reading back never stalls the pipeline. Rows are bottom to top, as OpenGL returns them.
+	class AsyncReadback
+	{
+	public:
+		// The image is owned by the ring and reused, it may be moved out of the callback to keep it
+		using Callback = std::function<void(Image&)>;
+
+	private:
+		struct Slot
+		{
+			Scope<PixelBuffer> Buffer;
+			Fence InFlight;
+
+			Vector2u Size;
+			Image Pixels;
+
+			Callback OnComplete;
+			bool Busy = false;
+		};
+
+		std::vector<Slot> m_Slots;
+		uint32_t m_Next   = 0;
+		uint32_t m_Oldest = 0;
+
+	public:
+		explicit AsyncReadback(uint32_t slots = 3);
+		~AsyncReadback();
+
+		AsyncReadback(const AsyncReadback&) = delete;
+		AsyncReadback& operator=(const AsyncReadback&) = delete;
+
+		// Returns false when every slot is still in flight, the request is dropped in that case
+		bool Read(const FrameBufferObject &frameBuffer, const UIntRect &rect, Callback callback, uint32_t attachment = 0);
+		bool Read(const TextureObject &texture, Callback callback, uint32_t level = 0);
+
+		// Completes finished requests in submission order, call once per frame
+		void Update();
+
+		// Blocks until every pending request has completed
+		void Flush();
+
+		size_t Pending() const;
+		uint32_t Slots() const { return static_cast<uint32_t>(m_Slots.size()); }
+
+	private:
+		Slot* Acquire(const Vector2u &size);
+		void Submit(Slot &slot, Callback callback);
+		void Complete(Slot &slot);
+	};
+}
@@ -18,6 +18,10 @@ namespace Game
 				return "Vertex buffer";
 			case BufferType::Uniform:
 				return "Uniform buffer";
+			case BufferType::PixelPack:
+				return "Pixel pack buffer";
+			case BufferType::PixelUnpack:
+				return "Pixel unpack buffer";
 			default:
 				return "Unknown";
 		}
@@ -0,0 +1,92 @@
+#include "pch.h"
+#include "Engine/OpenGL/Fence.h"
+
+#include "Engine/Renderer/Context.h"
+
+namespace Game
+{
+	Fence::Fence(bool flush)
+	{
+		const auto context = Context::GetContext();
+
+		ASSERT(context, "No active openGL context");
+		if(!context)
+			throw std::runtime_error("No active openGL context");
+
+		auto functions = context->GetFunctions();
+
+		m_Sync = functions.FenceSync();
+
+		// Other contexts only see the fence once it has reached the server
+		if(flush)
+			functions.Flush();
+	}
+
+	Fence::~Fence()
+	{
+		Reset();
+	}
+
+	Fence::Fence(Fence &&fence) noexcept : m_Sync(fence.m_Sync),
+	                                       m_Signaled(fence.m_Signaled)
+	{
+		fence.m_Sync     = nullptr;
+		fence.m_Signaled = false;
+	}
+
+	Fence& Fence::operator=(Fence &&fence) noexcept
+	{
+		if(this != &fence)
+		{
+			Reset();
+
+			std::swap(m_Sync, fence.m_Sync);
+			std::swap(m_Signaled, fence.m_Signaled);
+		}
+
+		return *this;
+	}
+
+	bool Fence::IsSignaled()
+	{
+		return Wait(0);
+	}
+
+	bool Fence::Wait(uint64_t timeout)
+	{
+		if(m_Signaled || !m_Sync)
+			return true;
+
+		const auto status = Context::GetContext()->GetFunctions().ClientWaitSync(m_Sync, timeout);
+
+		if(status == SyncStatus::WaitFailed)
+			GL_LOG_WARN("Fence wait failed");
+
+		m_Signaled = status != SyncStatus::TimeoutExpired;
+		return m_Signaled;
+	}
+
+	void Fence::ServerWait() const
+	{
+		if(m_Sync && !m_Signaled)
+			Context::GetContext()->GetFunctions().WaitSync(m_Sync);
+	}
+
+	void Fence::Reset()
+	{
+		if(m_Sync)
+		{
+			// Syncs can only be deleted through a context, drop fences before the last one of the share group is released
+			const auto context = Context::GetContext();
+
+			ASSERT(context, "Fence outlived its OpenGL context");
+			if(context)
+				context->GetFunctions().DeleteSync(m_Sync);
+			else
+				GL_LOG_ERROR("Fence reset without a current OpenGL context, its sync object leaks");
+		}
+
+		m_Sync     = nullptr;
+		m_Signaled = false;
+	}
+}
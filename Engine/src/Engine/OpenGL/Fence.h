@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/OpenGL/OpenGlFunctions.h"
+
+namespace Game
+{
+	class Fence
+	{
+		GLsync m_Sync = nullptr;
+		bool m_Signaled = false;
+
+	public:
+		Fence() = default;
+		explicit Fence(bool flush);
+		~Fence();
+
+		Fence(const Fence&) = delete;
+		Fence(Fence &&fence) noexcept;
+
+		Fence& operator=(const Fence&) = delete;
+		Fence& operator=(Fence &&fence) noexcept;
+
+		static Fence Insert(bool flush = true) { return Fence(flush); }
+
+		bool IsSignaled();
+		bool Wait(uint64_t timeout);
+
+		void ServerWait() const;
+
+		bool Valid() const { return m_Sync != nullptr; }
+		operator bool() const { return Valid(); }
+
+		void Reset();
+	};
+}
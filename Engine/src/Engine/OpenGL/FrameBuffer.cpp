@@ -80,7 +80,7 @@ namespace Game
 
 
 		GL_LOG_WARN("Unknown depth buffer size: '{}', Setting it to 24 bits and 8 Stencil bits", depth);
-		return InternalFormat::DepthComponent16;
+		return InternalFormat::Depth24Stencil8;
 	}
 
 	FrameBufferObject::Internals::Internals()
@@ -162,65 +162,92 @@ namespace Game
 		m_Internals->Functions.FrameBufferRenderBuffer(*this, attachment, GL_RENDERBUFFER, *buffer);
 	}
 
-	Ref<Texture> FrameBufferObject::SetUpColorTextureAttachment(
-		uint32_t width,
-		uint32_t height,
-		uint32_t index,
-		uint8_t depth
-		)
+	void FrameBufferObject::Detach(uint32_t attachment)
 	{
-		m_Internals->ColorAttachments++;
-		auto attachment = MakeRef<Texture>();
+		m_Internals->Functions.FrameBufferTexture(*this, attachment, 0, 0);
+	}
 
-		attachment->TextureObject::Create({width, height}, 1, GetColorFormat(depth));
-		attachment->SetWrapping(Wrapping::ClampEdge, Wrapping::ClampEdge);
-		attachment->SetFilters(Filter::Linear, Filter::Linear);
+	void FrameBufferObject::SetDrawBuffers(uint32_t count)
+	{
+		std::vector<uint32_t> buffers(count);
+		for(uint32_t i = 0; i < count; ++i)
+			buffers[i] = GL_COLOR_ATTACHMENT0 + i;
 
-		Attach(GL_COLOR_ATTACHMENT0 + index, attachment);
+		if(count == 0)
+			buffers.emplace_back(GL_NONE);
 
-		return attachment;
+		m_Internals->Functions.FrameBufferDrawBuffers(*this, static_cast<uint32_t>(buffers.size()), buffers.data());
+		m_Internals->ColorAttachments = count;
 	}
 
-	Ref<Texture> FrameBufferObject::SetUpColorTextureAttachment(const Vector2u &size, uint32_t index, uint8_t depth)
+	Ref<Texture> FrameBufferObject::CreateTextureAttachment(const RenderTargetDescription &description, Filter filter, RenderTargetPool *pool)
 	{
-		m_Internals->ColorAttachments++;
-		auto attachment = MakeRef<Texture>();
+		Ref<Texture> attachment;
 
-		attachment->TextureObject::Create(size, 1, GetColorFormat(depth));
-		attachment->SetWrapping(Wrapping::ClampEdge, Wrapping::ClampEdge);
-		attachment->SetFilters(Filter::Linear, Filter::Linear);
+		if(pool)
+			attachment = pool->AcquireTexture(description);
+		else
+		{
+			attachment = MakeRef<Texture>();
+			attachment->TextureObject::Create(description.Size, 1, description.Format);
+		}
 
-		Attach(GL_COLOR_ATTACHMENT0 + index, attachment);
+		// Pooled textures may have been reconfigured by their previous owner
+		attachment->SetWrapping(Wrapping::ClampEdge, Wrapping::ClampEdge);
+		attachment->SetFilters(filter, filter);
 
 		return attachment;
 	}
 
-	Ref<RenderBuffer> FrameBufferObject::SetUpColorRenderBufferAttachment(
+	Ref<RenderBuffer> FrameBufferObject::CreateRenderBufferAttachment(const RenderTargetDescription &description, RenderTargetPool *pool)
+	{
+		if(pool)
+			return pool->AcquireRenderBuffer(description);
+
+		return MakeRef<RenderBuffer>(description.Size, description.Format, description.Samples);
+	}
+
+	Ref<Texture> FrameBufferObject::SetUpColorTextureAttachment(
 		uint32_t width,
 		uint32_t height,
 		uint32_t index,
-		uint8_t depth
+		uint8_t depth,
+		RenderTargetPool *pool
 		)
 	{
-		m_Internals->ColorAttachments++;
-		auto attachment = MakeRef<RenderBuffer>();
+		return SetUpColorTextureAttachment(Vector2u{width, height}, index, depth, pool);
+	}
 
-		attachment->Storage(width, height, GetColorFormat(depth));
+	Ref<Texture> FrameBufferObject::SetUpColorTextureAttachment(const Vector2u &size, uint32_t index, uint8_t depth, RenderTargetPool *pool)
+	{
+		m_Internals->ColorAttachments++;
+		auto attachment = CreateTextureAttachment({size, GetColorFormat(depth)}, Filter::Linear, pool);
 
 		Attach(GL_COLOR_ATTACHMENT0 + index, attachment);
+
 		return attachment;
 	}
 
+	Ref<RenderBuffer> FrameBufferObject::SetUpColorRenderBufferAttachment(
+		uint32_t width,
+		uint32_t height,
+		uint32_t index,
+		uint8_t depth,
+		RenderTargetPool *pool
+		)
+	{
+		return SetUpColorRenderBufferAttachment(Vector2u{width, height}, index, depth, pool);
+	}
+
 	Ref<RenderBuffer> FrameBufferObject::SetUpColorRenderBufferAttachment(
 		const Vector2u &size,
 		uint32_t index,
-		uint8_t depth
+		uint8_t depth,
+		RenderTargetPool *pool
 		)
 	{
 		m_Internals->ColorAttachments++;
-		auto attachment = MakeRef<RenderBuffer>();
-
-		attachment->Storage(size, GetColorFormat(depth));
+		auto attachment = CreateRenderBufferAttachment({size, GetColorFormat(depth)}, pool);
 
 		Attach(GL_COLOR_ATTACHMENT0 + index, attachment);
 		return attachment;
@@ -230,33 +257,20 @@ namespace Game
 		uint32_t width,
 		uint32_t height,
 		uint8_t depth,
-		bool stencil
+		bool stencil,
+		RenderTargetPool *pool
 		)
 	{
-		if (depth == 0)
-			return nullptr;
-
-		auto attachment = MakeRef<Texture>();
-
-		attachment->TextureObject::Create({width, height}, 1, GetDepthFormat(depth, stencil));
-		attachment->SetWrapping(Wrapping::ClampEdge, Wrapping::ClampEdge);
-		attachment->SetFilters(Filter::Nearest, Filter::Nearest);
-		Attach(GL_DEPTH_COMPONENT, attachment);
-
-		return attachment;
+		return SetUpDepthTextureAttachment(Vector2u{width, height}, depth, stencil, pool);
 	}
 
-	Ref<Texture> FrameBufferObject::SetUpDepthTextureAttachment(const Vector2u &size, uint8_t depth, bool stencil)
+	Ref<Texture> FrameBufferObject::SetUpDepthTextureAttachment(const Vector2u &size, uint8_t depth, bool stencil, RenderTargetPool *pool)
 	{
 		if (depth == 0)
 			return nullptr;
 
-		auto attachment = MakeRef<Texture>();
-
-		attachment->TextureObject::Create(size, 1, GetDepthFormat(depth, stencil));
-		attachment->SetWrapping(Wrapping::ClampEdge, Wrapping::ClampEdge);
-		attachment->SetFilters(Filter::Nearest, Filter::Nearest);
-		Attach(GL_DEPTH_COMPONENT, attachment);
+		auto attachment = CreateTextureAttachment({size, GetDepthFormat(depth, stencil)}, Filter::Nearest, pool);
+		Attach(stencil ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT, attachment);
 
 		return attachment;
 	}
@@ -265,31 +279,25 @@ namespace Game
 		uint32_t width,
 		uint32_t height,
 		uint8_t depth,
-		bool stencil
+		bool stencil,
+		RenderTargetPool *pool
 		)
 	{
-		if (depth == 0)
-			return nullptr;
-
-		auto attachment = MakeRef<RenderBuffer>();
-
-		attachment->Storage(width, height, GetDepthFormat(depth, stencil));
-
-		return attachment;
+		return SetUpDepthRenderBufferAttachment(Vector2u{width, height}, depth, stencil, pool);
 	}
 
 	Ref<RenderBuffer> FrameBufferObject::SetUpDepthRenderBufferAttachment(
 		const Vector2u &size,
 		uint8_t depth,
-		bool stencil
+		bool stencil,
+		RenderTargetPool *pool
 		)
 	{
 		if (depth == 0)
 			return nullptr;
 
-		auto attachment = MakeRef<RenderBuffer>();
-
-		attachment->Storage(size, GetDepthFormat(depth, stencil));
+		auto attachment = CreateRenderBufferAttachment({size, GetDepthFormat(depth, stencil)}, pool);
+		Attach(stencil ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT, attachment);
 
 		return attachment;
 	}
@@ -4,6 +4,7 @@
 #include "Engine/Core/Vector2.h"
 #include "Engine/OpenGL/GLEnums.h"
 #include "Engine/OpenGL/OpenGlFunctions.h"
+#include "Engine/OpenGL/RenderTargetPool.h"
 
 namespace Game
 {
@@ -74,37 +75,60 @@ namespace Game
 		void Attach(uint32_t attachment, Ref<Texture> texture);
 		void Attach(uint32_t attachment, Ref<RenderBuffer> buffer);
 
-		Ref<Texture> SetUpColorTextureAttachment(uint32_t width, uint32_t height, uint32_t index, uint8_t depth);
-		Ref<Texture> SetUpColorTextureAttachment(const Vector2u &size, uint32_t index, uint8_t depth);
+		void ResetAttachments() { m_Internals->ColorAttachments = 0; }
+		void Detach(uint32_t attachment);
+
+		// Routes fragment outputs 0..count-1 to the matching color attachments
+		void SetDrawBuffers(uint32_t count);
+
+		Ref<Texture> SetUpColorTextureAttachment(uint32_t width, uint32_t height, uint32_t index, uint8_t depth, RenderTargetPool *pool = nullptr);
+		Ref<Texture> SetUpColorTextureAttachment(const Vector2u &size, uint32_t index, uint8_t depth, RenderTargetPool *pool = nullptr);
 
 		Ref<RenderBuffer> SetUpColorRenderBufferAttachment(
 			uint32_t width,
 			uint32_t height,
 			uint32_t index,
-			uint8_t depth
+			uint8_t depth,
+			RenderTargetPool *pool = nullptr
 			);
-		Ref<RenderBuffer> SetUpColorRenderBufferAttachment(const Vector2u &size, uint32_t index, uint8_t depth);
+		Ref<RenderBuffer> SetUpColorRenderBufferAttachment(const Vector2u &size, uint32_t index, uint8_t depth, RenderTargetPool *pool = nullptr);
 
-		Ref<Texture> SetUpDepthTextureAttachment(uint32_t width, uint32_t height, uint8_t depth, bool stencil = false);
-		Ref<Texture> SetUpDepthTextureAttachment(const Vector2u &size, uint8_t depth, bool stencil = false);
+		Ref<Texture> SetUpDepthTextureAttachment(uint32_t width, uint32_t height, uint8_t depth, bool stencil = false, RenderTargetPool *pool = nullptr);
+		Ref<Texture> SetUpDepthTextureAttachment(const Vector2u &size, uint8_t depth, bool stencil = false, RenderTargetPool *pool = nullptr);
 
 		Ref<RenderBuffer> SetUpDepthRenderBufferAttachment(
 			uint32_t width,
 			uint32_t height,
 			uint8_t depth,
-			bool stencil = false
+			bool stencil = false,
+			RenderTargetPool *pool = nullptr
 			);
-		Ref<RenderBuffer> SetUpDepthRenderBufferAttachment(const Vector2u &size, uint8_t depth, bool stencil = false);
+		Ref<RenderBuffer> SetUpDepthRenderBufferAttachment(const Vector2u &size, uint8_t depth, bool stencil = false, RenderTargetPool *pool = nullptr);
 
 		void CheckCompletion() const;
+
+	private:
+		static Ref<Texture> CreateTextureAttachment(const RenderTargetDescription &description, Filter filter, RenderTargetPool *pool);
+		static Ref<RenderBuffer> CreateRenderBufferAttachment(const RenderTargetDescription &description, RenderTargetPool *pool);
 	};
 
 	template <class ColorBufferType, class DepthBufferType>
 	class FrameBuffer: public FrameBufferObject
 	{
+		static_assert(std::is_same_v<ColorBufferType, Texture> || std::is_same_v<ColorBufferType, RenderBuffer>, "Unknown color buffer type for framebuffer");
+		static_assert(std::is_same_v<DepthBufferType, Texture> || std::is_same_v<DepthBufferType, RenderBuffer>, "Unknown depth buffer type for framebuffer");
+
 		std::vector<Ref<ColorBufferType>> m_ColorBuffer;
 		Ref<DepthBufferType> m_DepthBuffer = nullptr;
 
+		RenderTargetPool *m_Pool = nullptr;
+
+		Vector2u m_Size;
+		uint32_t m_ColorAttachments = 1;
+		uint8_t m_ColorDepth        = 32;
+		uint8_t m_DepthDepth        = 24;
+		bool m_Stencil              = false;
+
 	public:
 		FrameBuffer(
 			uint32_t width,
@@ -113,7 +137,8 @@ namespace Game
 			uint8_t colorDepth        = 32,
 			uint8_t depthBuffer       = 24,
 			bool stencil              = false
-			);
+			) : FrameBuffer(Vector2u{width, height}, colorAttachments, colorDepth, depthBuffer, stencil) {}
+
 		explicit FrameBuffer(
 			const Vector2u &size,
 			uint32_t colorAttachments = 1,
@@ -122,6 +147,21 @@ namespace Game
 			bool stencil              = false
 			);
 
+		// Attachments come from the pool and go back to it on resize or destruction
+		FrameBuffer(
+			RenderTargetPool &pool,
+			const Vector2u &size,
+			uint32_t colorAttachments = 1,
+			uint8_t colorDepth        = 32,
+			uint8_t depthBuffer       = 24,
+			bool stencil              = false
+			);
+
+		void Resize(uint32_t width, uint32_t height) { Resize(Vector2u{width, height}); }
+		void Resize(const Vector2u &size);
+
+		Vector2u Size() const { return m_Size; }
+
 		Ref<ColorBufferType> GetColorAttachment(uint32_t index) const
 		{
 			ASSERT(index < GetNumColorAttachments(), "Out of Range");
@@ -137,71 +177,75 @@ namespace Game
 
 		Pointer<ColorBufferType> GetColorBuffer(uint32_t index = 0) const { return m_ColorBuffer.at(index); }
 		Pointer<DepthBufferType> GetDepthBuffer() const { return m_DepthBuffer; }
+
+	private:
+		void Create();
 	};
 
 	template <class ColorBufferType, class DepthBufferType>
 	FrameBuffer<ColorBufferType, DepthBufferType>::FrameBuffer(
-		uint32_t width,
-		uint32_t height,
+		const Vector2u &size,
 		uint32_t colorAttachments,
 		uint8_t colorDepth,
 		uint8_t depthBuffer,
 		bool stencil
-		)
+		) : m_Size(size),
+		    m_ColorAttachments(colorAttachments),
+		    m_ColorDepth(colorDepth),
+		    m_DepthDepth(depthBuffer),
+		    m_Stencil(stencil)
 	{
-		for(uint32_t i = 0; i < colorAttachments; ++i)
-		{
-			if constexpr(std::is_same_v<ColorBufferType, Texture>)
-				m_ColorBuffer.emplace_back(SetUpColorTextureAttachment(width, height, i, colorDepth));
-			else if constexpr(std::is_same_v<ColorBufferType, RenderBuffer>)
-				m_ColorBuffer.emplace_back(SetUpColorRenderBufferAttachment(width, height, i, colorDepth));
-			else
-			{
-				ASSERT(false, "Unkown color Buffer type for framebuffer");
-				break;
-			}
-		}
-		if constexpr(std::is_same_v<DepthBufferType, Texture>)
-			m_DepthBuffer = SetUpDepthTextureAttachment(width, height, depthBuffer, stencil);
-		if constexpr(std::is_same_v<DepthBufferType, RenderBuffer>)
-			m_DepthBuffer = SetUpDepthRenderBufferAttachment(width, height, depthBuffer, stencil);
-		else
-		{
-			ASSERT(false, "Unkown color Buffer type for framebuffer");
-		}
-
-		CheckCompletion();
+		Create();
 	}
 
 	template <class ColorBufferType, class DepthBufferType>
 	FrameBuffer<ColorBufferType, DepthBufferType>::FrameBuffer(
+		RenderTargetPool &pool,
 		const Vector2u &size,
 		uint32_t colorAttachments,
 		uint8_t colorDepth,
 		uint8_t depthBuffer,
 		bool stencil
-		)
+		) : m_Pool(&pool),
+		    m_Size(size),
+		    m_ColorAttachments(colorAttachments),
+		    m_ColorDepth(colorDepth),
+		    m_DepthDepth(depthBuffer),
+		    m_Stencil(stencil)
 	{
-		for(uint32_t i = 0; i < colorAttachments; ++i)
+		Create();
+	}
+
+	template <class ColorBufferType, class DepthBufferType>
+	void FrameBuffer<ColorBufferType, DepthBufferType>::Resize(const Vector2u &size)
+	{
+		if(size == m_Size)
+			return;
+
+		m_Size = size;
+		Create();
+	}
+
+	template <class ColorBufferType, class DepthBufferType>
+	void FrameBuffer<ColorBufferType, DepthBufferType>::Create()
+	{
+		ResetAttachments();
+
+		m_ColorBuffer.clear();
+		m_DepthBuffer = nullptr;
+
+		for(uint32_t i = 0; i < m_ColorAttachments; ++i)
 		{
 			if constexpr(std::is_same_v<ColorBufferType, Texture>)
-				m_ColorBuffer.emplace_back(SetUpColorTextureAttachment(size, i, colorDepth));
-			else if constexpr(std::is_same_v<ColorBufferType, RenderBuffer>)
-				m_ColorBuffer.emplace_back(SetUpColorRenderBufferAttachment(size, i, colorDepth));
+				m_ColorBuffer.emplace_back(SetUpColorTextureAttachment(m_Size, i, m_ColorDepth, m_Pool));
 			else
-			{
-				ASSERT(false, "Unkown color Buffer type for framebuffer");
-				break;
-			}
+				m_ColorBuffer.emplace_back(SetUpColorRenderBufferAttachment(m_Size, i, m_ColorDepth, m_Pool));
 		}
+
 		if constexpr(std::is_same_v<DepthBufferType, Texture>)
-			m_DepthBuffer = SetUpDepthTextureAttachment(size, depthBuffer, stencil);
-		if constexpr(std::is_same_v<DepthBufferType, RenderBuffer>)
-			m_DepthBuffer = SetUpDepthRenderBufferAttachment(size , depthBuffer, stencil);
+			m_DepthBuffer = SetUpDepthTextureAttachment(m_Size, m_DepthDepth, m_Stencil, m_Pool);
 		else
-		{
-			ASSERT(false, "Unkown color Buffer type for framebuffer");
-		}
+			m_DepthBuffer = SetUpDepthRenderBufferAttachment(m_Size, m_DepthDepth, m_Stencil, m_Pool);
 
 		CheckCompletion();
 	}
@@ -0,0 +1,545 @@
+#include "pch.h"
+#include "Engine/OpenGL/GLBackend.h"
+
+#include <glad/glad.h>
+
+namespace
+{
+	constexpr uint32_t TRACE_VERSION = 1;
+
+	template <typename Type>
+	void Write(std::vector<uint8_t> &out, const Type &value)
+	{
+		if constexpr(std::is_pointer_v<Type>)
+			Write(out, reinterpret_cast<uint64_t>(value));
+		else
+		{
+			static_assert(std::is_trivially_copyable_v<Type>, "Argument can not be recorded");
+
+			const auto bytes = reinterpret_cast<const uint8_t*>(&value);
+			out.insert(out.end(), bytes, bytes + sizeof(Type));
+		}
+	}
+
+	void WriteData(std::vector<uint8_t> &out, const void *data, size_t size)
+	{
+		Write(out, static_cast<uint64_t>(data ? size : 0));
+
+		if(data)
+			out.insert(out.end(), static_cast<const uint8_t*>(data), static_cast<const uint8_t*>(data) + size);
+	}
+
+	void WriteString(std::vector<uint8_t> &out, const GLchar *text, int64_t length = -1)
+	{
+		WriteData(out, text, text ? static_cast<size_t>(length < 0 ? std::strlen(text) : length) : 0);
+	}
+
+	// Pointer arguments are recorded by address, the calls below also get the memory they point at
+	template <Game::GLFunction Function, typename... Arguments>
+	void WritePayload(std::vector<uint8_t> &out, const Arguments &... arguments)
+	{
+		using Game::GLFunction;
+
+		[[maybe_unused]] const auto values = std::forward_as_tuple(arguments...);
+
+		if constexpr(Function == GLFunction::NamedBufferData)
+			WriteData(out, std::get<2>(values), static_cast<size_t>(std::get<1>(values)));
+		else if constexpr(Function == GLFunction::NamedBufferSubData)
+			WriteData(out, std::get<3>(values), static_cast<size_t>(std::get<2>(values)));
+		else if constexpr(Function == GLFunction::ShaderSource)
+		{
+			const auto strings = std::get<2>(values);
+			const auto lengths = std::get<3>(values);
+
+			for(GLsizei i = 0; i < std::get<1>(values); ++i)
+				WriteString(out, strings[i], lengths ? lengths[i] : -1);
+		}
+		else if constexpr(Function == GLFunction::PushDebugGroup)
+			WriteString(out, std::get<3>(values), std::get<2>(values));
+		else if constexpr(Function == GLFunction::GetUniformLocation || Function == GLFunction::GetAttribLocation ||
+		                  Function == GLFunction::GetUniformBlockIndex)
+			WriteString(out, std::get<1>(values));
+	}
+
+	namespace NullDevice
+	{
+		std::atomic<GLuint> s_Names     = 0;
+		std::atomic<GLint> s_Locations = 0;
+
+		std::mutex s_BufferMutex;
+		std::unordered_map<GLuint, std::vector<uint8_t>> s_Buffers;
+
+		void GenerateNames(GLsizei count, GLuint *names)
+		{
+			for(GLsizei i = 0; i < count; ++i)
+				names[i] = ++s_Names;
+		}
+
+		void APIENTRY GenNames(GLsizei count, GLuint *names)
+		{
+			GenerateNames(count, names);
+		}
+
+		void APIENTRY CreateQueries(GLenum, GLsizei count, GLuint *names)
+		{
+			GenerateNames(count, names);
+		}
+
+		GLuint APIENTRY CreateShader(GLenum)
+		{
+			return ++s_Names;
+		}
+
+		GLuint APIENTRY CreateProgram()
+		{
+			return ++s_Names;
+		}
+
+		// Buffers keep their storage so mapping them hands out usable memory
+		void APIENTRY NamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum)
+		{
+			std::scoped_lock lock(s_BufferMutex);
+
+			auto &storage = s_Buffers[buffer];
+			storage.assign(static_cast<size_t>(size), 0);
+
+			if(data)
+				std::memcpy(storage.data(), data, storage.size());
+		}
+
+		void APIENTRY NamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data)
+		{
+			std::scoped_lock lock(s_BufferMutex);
+
+			const auto it = s_Buffers.find(buffer);
+			if(it != s_Buffers.end() && data && static_cast<size_t>(offset + size) <= it->second.size())
+				std::memcpy(it->second.data() + offset, data, static_cast<size_t>(size));
+		}
+
+		void* APIENTRY MapNamedBuffer(GLuint buffer, GLenum)
+		{
+			std::scoped_lock lock(s_BufferMutex);
+
+			const auto it = s_Buffers.find(buffer);
+			return it != s_Buffers.end() && !it->second.empty() ? it->second.data() : nullptr;
+		}
+
+		GLboolean APIENTRY UnmapNamedBuffer(GLuint)
+		{
+			return GL_TRUE;
+		}
+
+		void APIENTRY DeleteBuffers(GLsizei count, const GLuint *buffers)
+		{
+			std::scoped_lock lock(s_BufferMutex);
+
+			for(GLsizei i = 0; i < count; ++i)
+				s_Buffers.erase(buffers[i]);
+		}
+
+		GLenum APIENTRY CheckNamedFramebufferStatus(GLuint, GLenum)
+		{
+			return GL_FRAMEBUFFER_COMPLETE;
+		}
+
+		GLsync APIENTRY FenceSync(GLenum, GLbitfield)
+		{
+			static int sync = 0;
+			return reinterpret_cast<GLsync>(&sync);
+		}
+
+		GLenum APIENTRY ClientWaitSync(GLsync, GLbitfield, GLuint64)
+		{
+			return GL_ALREADY_SIGNALED;
+		}
+
+		const GLubyte* APIENTRY GetString(GLenum name)
+		{
+			const char *value = "";
+
+			switch(name)
+			{
+				case GL_VENDOR:
+					value = "Game";
+					break;
+				case GL_RENDERER:
+					value = "Null device";
+					break;
+				case GL_VERSION:
+					value = "4.6 Null";
+					break;
+				case GL_SHADING_LANGUAGE_VERSION:
+					value = "4.60";
+					break;
+				default:
+					break;
+			}
+
+			return reinterpret_cast<const GLubyte*>(value);
+		}
+
+		const GLubyte* APIENTRY GetStringi(GLenum, GLuint)
+		{
+			return reinterpret_cast<const GLubyte*>("");
+		}
+
+		// Implementation limits are the minimums GL 4.6 guarantees, so size checks pass as they would on real hardware
+		GLint GetValue(GLenum name)
+		{
+			switch(name)
+			{
+				case GL_MAJOR_VERSION:
+					return 4;
+				case GL_MINOR_VERSION:
+					return 6;
+				case GL_MAX_TEXTURE_SIZE:
+				case GL_MAX_CUBE_MAP_TEXTURE_SIZE:
+				case GL_MAX_RENDERBUFFER_SIZE:
+				case GL_MAX_VIEWPORT_DIMS:
+				case GL_MAX_UNIFORM_BLOCK_SIZE:
+					return 16384;
+				case GL_MAX_3D_TEXTURE_SIZE:
+				case GL_MAX_ARRAY_TEXTURE_LAYERS:
+					return 2048;
+				case GL_MAX_TEXTURE_BUFFER_SIZE:
+					return 65536;
+				case GL_MAX_TEXTURE_IMAGE_UNITS:
+				case GL_MAX_VERTEX_ATTRIBS:
+					return 16;
+				case GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS:
+					return 80;
+				case GL_MAX_UNIFORM_BUFFER_BINDINGS:
+					return 84;
+				case GL_MAX_COLOR_ATTACHMENTS:
+				case GL_MAX_DRAW_BUFFERS:
+					return 8;
+				case GL_MAX_SAMPLES:
+					return 4;
+				case GL_MAX_TEXTURE_LOD_BIAS:
+					return 2;
+				default:
+					return 0;
+			}
+		}
+
+		template <typename Type>
+		void APIENTRY GetValues(GLenum name, Type *data)
+		{
+			// The only multi-valued limit the engine asks for, width and height
+			const size_t count = name == GL_MAX_VIEWPORT_DIMS ? 2 : 1;
+
+			for(size_t i = 0; i < count; ++i)
+				data[i] = static_cast<Type>(GetValue(name));
+		}
+
+		template <typename Type>
+		void APIENTRY GetIndexedValue(GLenum name, GLuint, Type *data)
+		{
+			*data = static_cast<Type>(GetValue(name));
+		}
+
+		void APIENTRY GetBooleanv(GLenum, GLboolean *data)
+		{
+			*data = GL_FALSE;
+		}
+
+		void APIENTRY GetBooleani_v(GLenum, GLuint, GLboolean *data)
+		{
+			*data = GL_FALSE;
+		}
+
+		void APIENTRY GetObjectiv(GLuint, GLenum name, GLint *params)
+		{
+			*params = name == GL_COMPILE_STATUS || name == GL_LINK_STATUS || name == GL_VALIDATE_STATUS ? GL_TRUE : 0;
+		}
+
+		void APIENTRY GetInfoLog(GLuint, GLsizei size, GLsizei *length, GLchar *log)
+		{
+			if(length)
+				*length = 0;
+
+			if(log && size > 0)
+				log[0] = '\0';
+		}
+
+		void APIENTRY GetProgramBinary(GLuint, GLsizei, GLsizei *length, GLenum *format, void*)
+		{
+			if(length)
+				*length = 0;
+
+			if(format)
+				*format = 0;
+		}
+
+		void APIENTRY GetQueryObjectuiv(GLuint, GLenum, GLuint *params)
+		{
+			*params = GL_TRUE;
+		}
+
+		void APIENTRY GetQueryObjectui64v(GLuint, GLenum, GLuint64 *params)
+		{
+			*params = 0;
+		}
+
+		GLboolean APIENTRY IsProgram(GLuint program)
+		{
+			return program != 0 ? GL_TRUE : GL_FALSE;
+		}
+
+		// Every uniform is reported as present so uploads take the same path as on a driver
+		GLint APIENTRY GetUniformLocation(GLuint, const GLchar*)
+		{
+			return s_Locations++;
+		}
+	}
+}
+
+namespace Game
+{
+	template <GLFunction Function, typename Signature>
+	struct GLHook;
+
+	template <GLFunction Function, typename Return, typename... Arguments>
+	struct GLHook<Function, Return(APIENTRYP)(Arguments...)>
+	{
+		using Pointer = Return(APIENTRYP)(Arguments...);
+
+		static inline Pointer Native = nullptr;
+		static inline Pointer Target = nullptr;
+
+		static Return APIENTRY Null(Arguments...)
+		{
+			if constexpr(!std::is_void_v<Return>)
+				return Return{};
+		}
+
+		static Return APIENTRY Record(Arguments... arguments)
+		{
+			++GLBackend::s_Calls[static_cast<size_t>(Function)];
+
+			if(GLBackend::s_Tracing)
+			{
+				thread_local std::vector<uint8_t> buffer;
+				buffer.clear();
+
+				(Write(buffer, arguments), ...);
+				WritePayload<Function>(buffer, arguments...);
+
+				GLBackend::Record(Function, buffer);
+			}
+
+			return Target(arguments...);
+		}
+	};
+
+#define GAME_GL_HOOK(name) GLHook<GLFunction::name, decltype(glad_gl##name)>
+
+	static void InstallNull()
+	{
+#define GAME_GL_INSTALL_NULL(name) glad_gl##name = &GAME_GL_HOOK(name)::Null;
+		GAME_GL_FUNCTIONS(GAME_GL_INSTALL_NULL)
+#undef GAME_GL_INSTALL_NULL
+
+		glad_glCreateBuffers      = NullDevice::GenNames;
+		glad_glGenTextures        = NullDevice::GenNames;
+		glad_glGenFramebuffers    = NullDevice::GenNames;
+		glad_glGenRenderbuffers   = NullDevice::GenNames;
+		glad_glCreateQueries      = NullDevice::CreateQueries;
+		glad_glCreateShader       = NullDevice::CreateShader;
+		glad_glCreateProgram      = NullDevice::CreateProgram;
+		glad_glNamedBufferData    = NullDevice::NamedBufferData;
+		glad_glNamedBufferSubData = NullDevice::NamedBufferSubData;
+		glad_glMapNamedBuffer     = NullDevice::MapNamedBuffer;
+		glad_glUnmapNamedBuffer   = NullDevice::UnmapNamedBuffer;
+		glad_glDeleteBuffers      = NullDevice::DeleteBuffers;
+
+		glad_glCheckNamedFramebufferStatus = NullDevice::CheckNamedFramebufferStatus;
+		glad_glFenceSync                   = NullDevice::FenceSync;
+		glad_glClientWaitSync              = NullDevice::ClientWaitSync;
+
+		glad_glGetString     = NullDevice::GetString;
+		glad_glGetStringi    = NullDevice::GetStringi;
+		glad_glGetBooleanv   = NullDevice::GetBooleanv;
+		glad_glGetDoublev    = NullDevice::GetValues<GLdouble>;
+		glad_glGetFloatv     = NullDevice::GetValues<GLfloat>;
+		glad_glGetIntegerv   = NullDevice::GetValues<GLint>;
+		glad_glGetInteger64v = NullDevice::GetValues<GLint64>;
+
+		glad_glGetBooleani_v   = NullDevice::GetBooleani_v;
+		glad_glGetDoublei_v    = NullDevice::GetIndexedValue<GLdouble>;
+		glad_glGetFloati_v     = NullDevice::GetIndexedValue<GLfloat>;
+		glad_glGetIntegeri_v   = NullDevice::GetIndexedValue<GLint>;
+		glad_glGetInteger64i_v = NullDevice::GetIndexedValue<GLint64>;
+
+		glad_glGetShaderiv         = NullDevice::GetObjectiv;
+		glad_glGetProgramiv        = NullDevice::GetObjectiv;
+		glad_glGetShaderInfoLog    = NullDevice::GetInfoLog;
+		glad_glGetProgramInfoLog   = NullDevice::GetInfoLog;
+		glad_glGetProgramBinary    = NullDevice::GetProgramBinary;
+		glad_glGetQueryObjectuiv   = NullDevice::GetQueryObjectuiv;
+		glad_glGetQueryObjectui64v = NullDevice::GetQueryObjectui64v;
+		glad_glIsProgram           = NullDevice::IsProgram;
+		glad_glGetUniformLocation  = NullDevice::GetUniformLocation;
+	}
+
+	// An entry point missing from GAME_GL_FUNCTIONS keeps whatever glad loaded, nothing under the null device
+	static bool IsRouted()
+	{
+		bool routed = true;
+
+#define GAME_GL_CHECK_ROUTED(name) \
+		if(!glad_gl##name) \
+		{ \
+			GL_LOG_ERROR("gl{} has no entry point after installing the GL backend", #name); \
+			routed = false; \
+		}
+		GAME_GL_FUNCTIONS(GAME_GL_CHECK_ROUTED)
+#undef GAME_GL_CHECK_ROUTED
+
+		return routed;
+	}
+
+	void GLBackend::Install(GLBackendType type)
+	{
+		if(type == s_Type)
+			return;
+
+		if(s_Type == GLBackendType::Native)
+		{
+#define GAME_GL_SAVE_NATIVE(name) GAME_GL_HOOK(name)::Native = glad_gl##name;
+			GAME_GL_FUNCTIONS(GAME_GL_SAVE_NATIVE)
+#undef GAME_GL_SAVE_NATIVE
+		}
+
+		switch(type)
+		{
+			case GLBackendType::Native:
+#define GAME_GL_INSTALL_NATIVE(name) glad_gl##name = GAME_GL_HOOK(name)::Native;
+				GAME_GL_FUNCTIONS(GAME_GL_INSTALL_NATIVE)
+#undef GAME_GL_INSTALL_NATIVE
+				break;
+
+			case GLBackendType::Null:
+				InstallNull();
+				break;
+
+			case GLBackendType::Recording:
+				InstallNull();
+
+#define GAME_GL_INSTALL_RECORDING(name) \
+				GAME_GL_HOOK(name)::Target = GAME_GL_HOOK(name)::Native ? GAME_GL_HOOK(name)::Native : glad_gl##name; \
+				glad_gl##name = &GAME_GL_HOOK(name)::Record;
+				GAME_GL_FUNCTIONS(GAME_GL_INSTALL_RECORDING)
+#undef GAME_GL_INSTALL_RECORDING
+				break;
+		}
+
+		GL_LOG_INFO("Installed {} OpenGL backend", type == GLBackendType::Native ? "native" : type == GLBackendType::Null ? "null" : "recording");
+		s_Type = type;
+
+		if(type != GLBackendType::Native)
+		{
+			[[maybe_unused]] const bool routed = IsRouted();
+			ASSERT(routed, "GL backend left entry points unset");
+		}
+	}
+
+	bool GLBackend::IsDriverLoaded()
+	{
+		if(s_Type == GLBackendType::Native)
+			return glad_glClear != nullptr;
+
+		return s_Type == GLBackendType::Recording && GAME_GL_HOOK(Clear)::Native != nullptr;
+	}
+
+	bool GLBackend::OpenTrace(const std::filesystem::path &path)
+	{
+		std::scoped_lock lock(s_TraceMutex);
+
+		if(s_Trace.is_open())
+			s_Trace.close();
+
+		s_Trace.open(path, std::ios::binary | std::ios::trunc);
+
+		if(!s_Trace.is_open())
+		{
+			GL_LOG_ERROR("Unable to open GL trace: {}", path.string());
+			return false;
+		}
+
+		// Header followed by the function names, so traces stay readable when the list changes
+		std::vector<uint8_t> header;
+		header.insert(header.end(), {'G', 'L', 'T', 'R'});
+
+		Write(header, TRACE_VERSION);
+		Write(header, static_cast<uint16_t>(FUNCTION_COUNT));
+
+		for(size_t i = 0; i < FUNCTION_COUNT; ++i)
+		{
+			const auto name = GetName(static_cast<GLFunction>(i));
+
+			Write(header, static_cast<uint16_t>(name.size()));
+			header.insert(header.end(), name.begin(), name.end());
+		}
+
+		s_Trace.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+		s_Tracing = true;
+
+		GL_LOG_INFO("Recording GL calls to {}", path.string());
+		return true;
+	}
+
+	void GLBackend::CloseTrace()
+	{
+		std::scoped_lock lock(s_TraceMutex);
+
+		s_Tracing = false;
+
+		if(s_Trace.is_open())
+			s_Trace.close();
+	}
+
+	uint64_t GLBackend::GetTotalCallCount()
+	{
+		uint64_t total = 0;
+		for(const auto &calls : s_Calls)
+			total += calls;
+
+		return total;
+	}
+
+	void GLBackend::ResetCallCounts()
+	{
+		for(auto &calls : s_Calls)
+			calls = 0;
+	}
+
+	std::string_view GLBackend::GetName(GLFunction function)
+	{
+		static constexpr std::array<std::string_view, FUNCTION_COUNT> names = {
+#define GAME_GL_FUNCTION_NAME(name) "gl" #name,
+			GAME_GL_FUNCTIONS(GAME_GL_FUNCTION_NAME)
+#undef GAME_GL_FUNCTION_NAME
+		};
+
+		const auto index = static_cast<size_t>(function);
+		return index < names.size() ? names[index] : std::string_view("Unknown");
+	}
+
+	void GLBackend::Record(GLFunction function, const std::vector<uint8_t> &arguments)
+	{
+		std::scoped_lock lock(s_TraceMutex);
+
+		if(!s_Trace.is_open())
+			return;
+
+		const auto id   = static_cast<uint16_t>(function);
+		const auto size = static_cast<uint32_t>(arguments.size());
+
+		s_Trace.write(reinterpret_cast<const char*>(&id), sizeof(id));
+		s_Trace.write(reinterpret_cast<const char*>(&size), sizeof(size));
+		s_Trace.write(reinterpret_cast<const char*>(arguments.data()), size);
+	}
+
+#undef GAME_GL_HOOK
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+
+#include <array>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+// Every GL entry point the engine calls, OpenGlFunctions and the direct calls in ShaderProgram, FrameBuffer and Context
+#define GAME_GL_FUNCTIONS(X) \
+	X(ActiveTexture) X(AttachShader) X(BindBuffer) X(BindBufferBase) X(BindBufferRange) X(BindFramebuffer) \
+	X(BindRenderbuffer) X(BindTexture) X(BlendEquationSeparate) X(BlendFuncSeparate) X(CheckNamedFramebufferStatus) \
+	X(Clear) X(ClearColor) X(ClientWaitSync) X(CompileShader) X(CompressedTextureSubImage2D) X(CreateBuffers) \
+	X(CreateProgram) X(CreateQueries) X(CreateShader) X(CullFace) X(DebugMessageCallback) X(DeleteBuffers) \
+	X(DeleteFramebuffers) X(DeleteProgram) X(DeleteQueries) X(DeleteRenderbuffers) X(DeleteShader) X(DeleteSync) \
+	X(DeleteTextures) X(DetachShader) X(Disable) X(Enable) X(FenceSync) X(Finish) X(Flush) X(FrontFace) \
+	X(GenFramebuffers) X(GenRenderbuffers) X(GenTextures) X(GenerateMipmap) X(GenerateTextureMipmap) \
+	X(GetActiveUniform) X(GetActiveUniformBlockName) X(GetActiveUniformBlockiv) X(GetActiveUniformsiv) \
+	X(GetAttribLocation) X(GetBooleani_v) X(GetBooleanv) X(GetDoublei_v) X(GetDoublev) X(GetFloati_v) \
+	X(GetFloatv) X(GetInteger64i_v) X(GetInteger64v) X(GetIntegeri_v) X(GetIntegerv) \
+	X(GetProgramBinary) X(GetProgramInfoLog) X(GetProgramiv) X(GetQueryObjectui64v) X(GetQueryObjectuiv) \
+	X(GetShaderInfoLog) X(GetShaderiv) X(GetString) X(GetStringi) X(GetTextureImage) X(GetUniformBlockIndex) \
+	X(GetUniformLocation) X(IsEnabled) X(IsProgram) X(LinkProgram) X(MapNamedBuffer) X(NamedBufferData) \
+	X(NamedBufferSubData) X(NamedFramebufferDrawBuffers) X(NamedFramebufferReadBuffer) \
+	X(NamedFramebufferRenderbuffer) X(NamedFramebufferTexture) X(NamedRenderbufferStorage) \
+	X(NamedRenderbufferStorageMultisample) X(PopDebugGroup) X(ProgramBinary) X(ProgramParameteri) \
+	X(ProgramUniform1fv) X(ProgramUniform1i) X(ProgramUniform1iv) X(ProgramUniform1uiv) X(ProgramUniform2fv) \
+	X(ProgramUniform2iv) X(ProgramUniform2uiv) X(ProgramUniform3fv) X(ProgramUniform3iv) X(ProgramUniform3uiv) \
+	X(ProgramUniform4fv) X(ProgramUniformMatrix2fv) X(ProgramUniformMatrix2x3fv) X(ProgramUniformMatrix2x4fv) \
+	X(ProgramUniformMatrix3fv) X(ProgramUniformMatrix3x2fv) X(ProgramUniformMatrix3x4fv) X(ProgramUniformMatrix4fv) \
+	X(ProgramUniformMatrix4x2fv) X(ProgramUniformMatrix4x3fv) X(PushDebugGroup) X(QueryCounter) X(ReadPixels) \
+	X(ShaderSource) X(StencilFuncSeparate) X(StencilOpSeparate) X(TexImage2D) X(TextureParameterf) \
+	X(TextureParameterfv) X(TextureParameteri) X(TextureParameteriv) X(TextureStorage2D) X(TextureSubImage2D) \
+	X(UnmapNamedBuffer) X(UseProgram) X(Viewport) X(WaitSync)
+
+namespace Game
+{
+	enum class GLFunction : uint16_t
+	{
+#define GAME_GL_FUNCTION_ENUM(name) name,
+		GAME_GL_FUNCTIONS(GAME_GL_FUNCTION_ENUM)
+#undef GAME_GL_FUNCTION_ENUM
+		Count
+	};
+
+	enum class GLBackendType
+	{
+		// Driver entry points loaded by glad
+		Native,
+		// Calls do nothing, object names are still handed out and every status query reports success
+		Null,
+		// Counts every call and optionally writes it to a trace, then forwards to the driver, or to the null device when no driver is loaded
+		Recording
+	};
+
+	// Routes the engine's GL calls by swapping glad's function pointers, install it after the first context loaded glad
+	class GLBackend
+	{
+		static constexpr size_t FUNCTION_COUNT = static_cast<size_t>(GLFunction::Count);
+
+		static inline GLBackendType s_Type = GLBackendType::Native;
+
+		static inline std::array<std::atomic<uint64_t>, FUNCTION_COUNT> s_Calls{};
+
+		static inline std::ofstream s_Trace;
+		static inline std::mutex s_TraceMutex;
+		static inline std::atomic<bool> s_Tracing = false;
+
+	public:
+		static void Install(GLBackendType type);
+		static GLBackendType GetType() { return s_Type; }
+
+		// Whether calls can reach a driver, false for the null device and recordings on top of it
+		static bool IsDriverLoaded();
+
+		// Binary trace of the call stream, only written while the recording backend is installed
+		static bool OpenTrace(const std::filesystem::path &path);
+		static void CloseTrace();
+		static bool IsTracing() { return s_Tracing; }
+
+		static uint64_t GetCallCount(GLFunction function) { return s_Calls[static_cast<size_t>(function)]; }
+		static uint64_t GetTotalCallCount();
+		static void ResetCallCounts();
+
+		static std::string_view GetName(GLFunction function);
+
+	private:
+		template <GLFunction Function, typename Signature>
+		friend struct GLHook;
+
+		static void Record(GLFunction function, const std::vector<uint8_t> &arguments);
+	};
+}
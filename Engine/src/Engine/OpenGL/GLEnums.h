@@ -3,6 +3,28 @@
 #include <glad/glad.h>
 #include "Engine/Core/Base.h"
 
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+#ifndef GL_MAX_SHADER_COMPILER_THREADS_KHR
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#endif
+
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#define GL_COMPRESSED_RGBA_S3TC_DXT3_EXT 0x83F2
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
+#ifndef GL_COMPRESSED_SRGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_SRGB_S3TC_DXT1_EXT 0x8C4C
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT 0x8C4D
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT 0x8C4E
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT 0x8C4F
+#endif
+
 namespace Game
 {
 	enum class UniformType : GLenum
@@ -46,7 +68,18 @@ namespace Game
 
 		Sampler1D = GL_SAMPLER_1D,
 		Sampler2D = GL_SAMPLER_2D,
-		Sampler3D = GL_SAMPLER_3D
+		Sampler3D = GL_SAMPLER_3D,
+		SamplerCube = GL_SAMPLER_CUBE,
+		Sampler2DShadow = GL_SAMPLER_2D_SHADOW,
+		Sampler2DArray = GL_SAMPLER_2D_ARRAY,
+		Sampler2DArrayShadow = GL_SAMPLER_2D_ARRAY_SHADOW,
+		SamplerCubeShadow = GL_SAMPLER_CUBE_SHADOW,
+		Sampler2DMultisample = GL_SAMPLER_2D_MULTISAMPLE,
+		SamplerBuffer = GL_SAMPLER_BUFFER,
+		ISampler2D = GL_INT_SAMPLER_2D,
+		USampler2D = GL_UNSIGNED_INT_SAMPLER_2D,
+
+		Image2D = GL_IMAGE_2D
 	};
 
 	enum class InternalFormat : int32_t
@@ -60,6 +93,20 @@ namespace Game
 		CompressedSignedRedRGTC1 = GL_COMPRESSED_SIGNED_RED_RGTC1,
 		CompressedSignedRGRGTC2 = GL_COMPRESSED_SIGNED_RG_RGTC2,
 		CompressedSRGB = GL_COMPRESSED_SRGB,
+		CompressedRGBS3TCDXT1 = GL_COMPRESSED_RGB_S3TC_DXT1_EXT,
+		CompressedRGBAS3TCDXT1 = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,
+		CompressedRGBAS3TCDXT3 = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT,
+		CompressedRGBAS3TCDXT5 = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT,
+		CompressedSRGBS3TCDXT1 = GL_COMPRESSED_SRGB_S3TC_DXT1_EXT,
+		CompressedSRGBAS3TCDXT1 = GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT,
+		CompressedSRGBAS3TCDXT3 = GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT,
+		CompressedSRGBAS3TCDXT5 = GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT,
+		CompressedRGBABPTC = GL_COMPRESSED_RGBA_BPTC_UNORM,
+		CompressedSRGBABPTC = GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM,
+		CompressedRGB8ETC2 = GL_COMPRESSED_RGB8_ETC2,
+		CompressedSRGB8ETC2 = GL_COMPRESSED_SRGB8_ETC2,
+		CompressedRGBA8ETC2EAC = GL_COMPRESSED_RGBA8_ETC2_EAC,
+		CompressedSRGB8A8ETC2EAC = GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC,
 		DepthStencil = GL_DEPTH_STENCIL,
 		Depth24Stencil8 = GL_DEPTH24_STENCIL8,
 		Depth32FStencil8 = GL_DEPTH32F_STENCIL8,
@@ -315,7 +362,9 @@ namespace Game
 	{
 		Index = GL_ELEMENT_ARRAY_BUFFER,
 		Vertex = GL_ARRAY_BUFFER,
-		Uniform = GL_UNIFORM_BUFFER
+		Uniform = GL_UNIFORM_BUFFER,
+		PixelPack = GL_PIXEL_PACK_BUFFER,
+		PixelUnpack = GL_PIXEL_UNPACK_BUFFER
 	};
 
 	enum class BufferAccess: uint32_t
@@ -325,6 +374,14 @@ namespace Game
 		ReadWrite = GL_READ_WRITE
 	};
 
+	enum class SyncStatus : uint32_t
+	{
+		AlreadySignaled = GL_ALREADY_SIGNALED,
+		TimeoutExpired = GL_TIMEOUT_EXPIRED,
+		ConditionSatisfied = GL_CONDITION_SATISFIED,
+		WaitFailed = GL_WAIT_FAILED
+	};
+
 	enum class TextureParameterName : uint32_t
 	{
 		DepthStencilMode = GL_DEPTH_STENCIL_TEXTURE_MODE,
@@ -391,7 +448,8 @@ namespace Game
 		DeleteStatus = GL_DELETE_STATUS,
 		CompileStatus = GL_COMPILE_STATUS,
 		LogLength = GL_INFO_LOG_LENGTH,
-		SourceLength = GL_SHADER_SOURCE_LENGTH
+		SourceLength = GL_SHADER_SOURCE_LENGTH,
+		CompletionStatus = GL_COMPLETION_STATUS_KHR
 	};
 
 	inline BufferBit operator|(const BufferBit &left, const BufferBit &right)
@@ -8,6 +8,13 @@
 		throw std::runtime_error("Not in current OpenGL Context");\
 	}
 
+// Buffers, textures, renderbuffers, shaders, programs and syncs may be used from any context of their share group
+#define CHECK_FOR_SHARED_CONTEXT() { \
+	ASSERT(m_Context->IsShareGroupCurrent(), "No context of the OpenGL share group is current");\
+	if (!m_Context->IsShareGroupCurrent())\
+		throw std::runtime_error("No context of the OpenGL share group is current");\
+	}
+
 namespace Game
 {
 	OpenGlFunctions *OpenGlFunctions::s_Instance = nullptr;
@@ -50,7 +57,7 @@ namespace Game
 	{
 		ASSERT(s_Instance, "Insance of OpenGLFunctions does not exists");
 
-		if(s_Instance->m_Context->IsCurrent())
+		if(!s_Instance->m_Context->IsShareGroupCurrent())
 		{
 			ASSERT(false, "Not in current OpenGL Context");
 		}
@@ -225,7 +232,7 @@ namespace Game
 
 	uint32_t OpenGlFunctions::GenTexture()
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		uint32_t texture = 0;
 		glGenTextures(1, &texture);
@@ -244,7 +251,7 @@ namespace Game
 
 	void OpenGlFunctions::GenTextures(uint32_t account, uint32_t *textures)
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		glGenTextures(static_cast<GLsizei>(account), textures);
 	}
@@ -256,14 +263,14 @@ namespace Game
 
 	void OpenGlFunctions::DeleteTextures(uint32_t account, uint32_t *textures)
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		glDeleteTextures(static_cast<GLsizei>(account), textures);
 	}
 
 	void OpenGlFunctions::TextureParameter(uint32_t texture, TextureParameterName name, float param)
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		ASSERT(name != TextureParameterName::SwizzleRGBA || name != TextureParameterName::BorderColor);
 
@@ -272,7 +279,7 @@ namespace Game
 
 	void OpenGlFunctions::TextureParameter(uint32_t texture, TextureParameterName name, int32_t param)
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		ASSERT(name != TextureParameterName::SwizzleRGBA || name != TextureParameterName::BorderColor);
 
@@ -281,28 +288,28 @@ namespace Game
 
 	void OpenGlFunctions::TextureParameter(uint32_t texture, TextureParameterName name, const float *param)
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		glTextureParameterfv(texture, static_cast<GLenum>(name), param);
 	}
 
 	void OpenGlFunctions::TextureParameter(uint32_t texture, TextureParameterName name, const int32_t *param)
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		glTextureParameteriv(texture, static_cast<GLenum>(name), param);
 	}
 
 	void OpenGlFunctions::GenerateMipMap(uint32_t texture)
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		glGenerateTextureMipmap(texture);
 	}
 
 	void OpenGlFunctions::GenerateMipMap(TextureTarget target, uint32_t texture)
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		ASSERT(IsBindable(target));
 		glBindTexture(static_cast<GLenum>(target), texture);
@@ -322,7 +329,7 @@ namespace Game
 		const void *data
 		)
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		ASSERT(IsBindable(target));
 		glBindTexture(static_cast<GLenum>(target), texture);
@@ -353,7 +360,7 @@ namespace Game
 		const void *data
 		)
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		ASSERT(IsBindable(bindTarget));
 		glBindTexture(static_cast<GLenum>(bindTarget), texture);
@@ -383,7 +390,7 @@ namespace Game
 		const void *data
 		)
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		glTextureSubImage2D(
 		                    texture,
@@ -410,7 +417,7 @@ namespace Game
 		const void *data
 		)
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		ASSERT(IsBindable(target));
 		glBindTexture(static_cast<GLenum>(target), texture);
@@ -440,7 +447,7 @@ namespace Game
 		const void *data
 		)
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		ASSERT(IsBindable(bindTarget));
 		glBindTexture(static_cast<GLenum>(bindTarget), texture);
@@ -489,7 +496,7 @@ namespace Game
 		const void *data
 		)
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		glTextureSubImage2D(
 		                    texture,
@@ -504,9 +511,34 @@ namespace Game
 		                   );
 	}
 
+	void OpenGlFunctions::CompressedSubImage2D(
+		uint32_t texture,
+		int32_t level,
+		const Vector2i &offset,
+		const Vector2u &size,
+		InternalFormat format,
+		size_t imageSize,
+		const void *data
+		)
+	{
+		CHECK_FOR_SHARED_CONTEXT();
+
+		glCompressedTextureSubImage2D(
+		                              texture,
+		                              level,
+		                              offset.X,
+		                              offset.Y,
+		                              static_cast<GLsizei>(size.Width),
+		                              static_cast<GLsizei>(size.Height),
+		                              static_cast<GLenum>(format),
+		                              static_cast<GLsizei>(imageSize),
+		                              data
+		                             );
+	}
+
 	void OpenGlFunctions::BindTexture(TextureTarget target, uint32_t texture) const
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		ASSERT(IsBindable(target));
 		glBindTexture(static_cast<GLenum>(target), texture);
@@ -514,7 +546,7 @@ namespace Game
 
 	void OpenGlFunctions::BindRenderBuffer(uint32_t buffer) const
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		glBindRenderbuffer(GL_RENDERBUFFER, buffer);
 	}
@@ -538,11 +570,26 @@ namespace Game
 		void *pixels
 		) const
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		glGetTextureImage(texture, level, static_cast<GLenum>(format), static_cast<GLenum>(type), static_cast<GLsizei>(bufferSize), pixels);
 	}
 
+	void OpenGlFunctions::ReadPixels(
+		int32_t x,
+		int32_t y,
+		uint32_t width,
+		uint32_t height,
+		Format format,
+		DataType type,
+		void *pixels
+		) const
+	{
+		CHECK_FOR_CURRENT_CONTEXT();
+
+		glReadPixels(x, y, static_cast<GLsizei>(width), static_cast<GLsizei>(height), static_cast<GLenum>(format), static_cast<GLenum>(type), pixels);
+	}
+
 	uint32_t OpenGlFunctions::GenRenderBuffer()
 	{
 		uint32_t buffer;
@@ -561,7 +608,7 @@ namespace Game
 
 	void OpenGlFunctions::GenRenderBuffers(uint32_t size, uint32_t *buffers)
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		glGenRenderbuffers(static_cast<GLsizei>(size), buffers);
 	}
@@ -573,7 +620,7 @@ namespace Game
 
 	void OpenGlFunctions::DeleteRenderBuffers(uint32_t size, uint32_t *buffers)
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		glDeleteRenderbuffers(static_cast<GLsizei>(size), buffers);
 	}
@@ -585,7 +632,7 @@ namespace Game
 		uint32_t height
 		)
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		glNamedRenderbufferStorage(
 		                           renderBuffer,
@@ -601,7 +648,7 @@ namespace Game
 		const Vector2u &size
 		)
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		glNamedRenderbufferStorage(
 		                           renderBuffer,
@@ -619,7 +666,7 @@ namespace Game
 		uint32_t height
 		)
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		glNamedRenderbufferStorageMultisample(
 		                                      renderBuffer,
@@ -637,7 +684,7 @@ namespace Game
 		const Vector2u &size
 		)
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		glNamedRenderbufferStorageMultisample(
 		                                      renderBuffer,
@@ -698,6 +745,20 @@ namespace Game
 		glNamedFramebufferTexture(frameBuffer, attachment, texture, level);
 	}
 
+	void OpenGlFunctions::FrameBufferReadBuffer(uint32_t frameBuffer, uint32_t mode)
+	{
+		CHECK_FOR_CURRENT_CONTEXT();
+
+		glNamedFramebufferReadBuffer(frameBuffer, mode);
+	}
+
+	void OpenGlFunctions::FrameBufferDrawBuffers(uint32_t frameBuffer, uint32_t size, const uint32_t *buffers)
+	{
+		CHECK_FOR_CURRENT_CONTEXT();
+
+		glNamedFramebufferDrawBuffers(frameBuffer, static_cast<GLsizei>(size), buffers);
+	}
+
 	void OpenGlFunctions::FrameBufferRenderBuffer(
 		uint32_t frameBuffer,
 		uint32_t attachment,
@@ -712,14 +773,14 @@ namespace Game
 
 	uint32_t OpenGlFunctions::CreateShader(uint32_t shaderType)
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		return glCreateShader(shaderType);
 	}
 
 	void OpenGlFunctions::DeleteShader(uint32_t shader)
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		glDeleteShader(shader);
 	}
@@ -731,7 +792,7 @@ namespace Game
 		const int32_t *length
 		)
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		glShaderSource(shader, static_cast<GLsizei>(count), string, length);
 	}
@@ -780,14 +841,14 @@ namespace Game
 
 	void OpenGlFunctions::CompileShader(uint32_t shader)
 	{
-		CHECK_FOR_CURRENT_CONTEXT()
+		CHECK_FOR_SHARED_CONTEXT()
 
 		glCompileShader(shader);
 	}
 
 	void OpenGlFunctions::GetShader(uint32_t shader, ShaderParameterName name, int32_t *params) const
 	{
-		CHECK_FOR_CURRENT_CONTEXT()
+		CHECK_FOR_SHARED_CONTEXT()
 
 		glGetShaderiv(shader, static_cast<GLenum>(name), params);
 	}
@@ -836,7 +897,7 @@ namespace Game
 
 	void OpenGlFunctions::CreateBuffers(uint32_t count, uint32_t *buffers)
 	{
-		CHECK_FOR_CURRENT_CONTEXT()
+		CHECK_FOR_SHARED_CONTEXT()
 
 		glCreateBuffers(static_cast<GLsizei>(count), buffers);
 	}
@@ -847,44 +908,127 @@ namespace Game
 	}
 	void OpenGlFunctions::DeleteBuffers(uint32_t count, uint32_t *buffers)
 	{
-		CHECK_FOR_CURRENT_CONTEXT()
+		CHECK_FOR_SHARED_CONTEXT()
 
 		glDeleteBuffers(static_cast<GLsizei>(count), buffers);
 	}
 
 	void OpenGlFunctions::BufferData(uint32_t buffer, BufferUsage usage, size_t size, const void *data)
 	{
-		CHECK_FOR_CURRENT_CONTEXT()
+		CHECK_FOR_SHARED_CONTEXT()
 
 		glNamedBufferData(buffer, static_cast<GLsizeiptr>(size), data, static_cast<GLenum>(usage));
 	}
 	void OpenGlFunctions::BufferSubData(uint32_t buffer, size_t offset, size_t size, const void *data)
 	{
-		CHECK_FOR_CURRENT_CONTEXT()
+		CHECK_FOR_SHARED_CONTEXT()
 
 		glNamedBufferSubData(buffer, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data);
 	}
 
 	void OpenGlFunctions::BindBuffer(uint32_t buffer, BufferType type) const
 	{
-		CHECK_FOR_CURRENT_CONTEXT()
+		CHECK_FOR_SHARED_CONTEXT()
 
 		glBindBuffer(static_cast<GLenum>(type), buffer);
 	}
 
 	void * OpenGlFunctions::MapBuffer(uint32_t buffer, BufferAccess access) const
 	{
-		CHECK_FOR_CURRENT_CONTEXT()
+		CHECK_FOR_SHARED_CONTEXT()
 
 		return glMapNamedBuffer(buffer, static_cast<GLenum>(access));
 	}
 	void OpenGlFunctions::UnMapBuffer(uint32_t buffer) const
 	{
-		CHECK_FOR_CURRENT_CONTEXT()
+		CHECK_FOR_SHARED_CONTEXT()
 
 		glUnmapNamedBuffer(buffer);
 	}
 
+	GLsync OpenGlFunctions::FenceSync() const
+	{
+		CHECK_FOR_SHARED_CONTEXT()
+
+		return glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+
+	SyncStatus OpenGlFunctions::ClientWaitSync(GLsync sync, uint64_t timeout, bool flush) const
+	{
+		CHECK_FOR_SHARED_CONTEXT()
+
+		return static_cast<SyncStatus>(glClientWaitSync(sync, flush ? GL_SYNC_FLUSH_COMMANDS_BIT : 0, timeout));
+	}
+
+	void OpenGlFunctions::WaitSync(GLsync sync) const
+	{
+		CHECK_FOR_SHARED_CONTEXT()
+
+		glWaitSync(sync, 0, GL_TIMEOUT_IGNORED);
+	}
+
+	void OpenGlFunctions::DeleteSync(GLsync sync) const
+	{
+		CHECK_FOR_SHARED_CONTEXT()
+
+		glDeleteSync(sync);
+	}
+
+	void OpenGlFunctions::CreateQueries(uint32_t target, uint32_t count, uint32_t *queries) const
+	{
+		CHECK_FOR_CURRENT_CONTEXT();
+
+		glCreateQueries(target, static_cast<GLsizei>(count), queries);
+	}
+
+	void OpenGlFunctions::DeleteQueries(uint32_t count, const uint32_t *queries) const
+	{
+		CHECK_FOR_CURRENT_CONTEXT();
+
+		glDeleteQueries(static_cast<GLsizei>(count), queries);
+	}
+
+	void OpenGlFunctions::QueryCounter(uint32_t query) const
+	{
+		CHECK_FOR_CURRENT_CONTEXT();
+
+		glQueryCounter(query, GL_TIMESTAMP);
+	}
+
+	bool OpenGlFunctions::IsQueryResultAvailable(uint32_t query) const
+	{
+		CHECK_FOR_CURRENT_CONTEXT();
+
+		GLuint available = GL_FALSE;
+		glGetQueryObjectuiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+
+		return available == GL_TRUE;
+	}
+
+	uint64_t OpenGlFunctions::GetQueryResult(uint32_t query) const
+	{
+		CHECK_FOR_CURRENT_CONTEXT();
+
+		GLuint64 result = 0;
+		glGetQueryObjectui64v(query, GL_QUERY_RESULT, &result);
+
+		return result;
+	}
+
+	void OpenGlFunctions::PushDebugGroup(std::string_view message, uint32_t id) const
+	{
+		CHECK_FOR_CURRENT_CONTEXT();
+
+		glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, id, static_cast<GLsizei>(message.size()), message.data());
+	}
+
+	void OpenGlFunctions::PopDebugGroup() const
+	{
+		CHECK_FOR_CURRENT_CONTEXT();
+
+		glPopDebugGroup();
+	}
+
 	std::string OpenGlFunctions::GetString(uint32_t name) const
 	{
 		return std::string(reinterpret_cast<const char*>(glGetString(name)));
@@ -983,14 +1127,14 @@ namespace Game
 
 	void OpenGlFunctions::Flush()
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		glFlush();
 	}
 
 	void OpenGlFunctions::Finish()
 	{
-		CHECK_FOR_CURRENT_CONTEXT();
+		CHECK_FOR_SHARED_CONTEXT();
 
 		glFinish();
 	}
@@ -341,6 +341,16 @@ namespace Game
 			const void *data
 			);
 
+		void CompressedSubImage2D(
+			uint32_t texture,
+			int32_t level,
+			const Vector2i &offset,
+			const Vector2u &size,
+			InternalFormat format,
+			size_t imageSize,
+			const void *data
+			);
+
 		void BindTexture(TextureTarget target, uint32_t texture) const;
 		void BindRenderBuffer(uint32_t buffer) const;
 		void BindFrameBuffer(uint32_t buffer, bool read = false) const;
@@ -354,6 +364,16 @@ namespace Game
 			void *pixels
 			) const;
 
+		void ReadPixels(
+			int32_t x,
+			int32_t y,
+			uint32_t width,
+			uint32_t height,
+			Format format,
+			DataType type,
+			void *pixels
+			) const;
+
 		uint32_t GenRenderBuffer();
 		uint32_t* GenRenderBuffers(uint32_t size);
 		void GenRenderBuffers(uint32_t size, uint32_t *buffers);
@@ -387,6 +407,8 @@ namespace Game
 
 		uint32_t CheckFrameBufferStatus(uint32_t frameBuffer, uint32_t target = GL_DRAW_FRAMEBUFFER);
 		void FrameBufferTexture(uint32_t frameBuffer, uint32_t attachment, uint32_t texture, int32_t level);
+		void FrameBufferReadBuffer(uint32_t frameBuffer, uint32_t mode);
+		void FrameBufferDrawBuffers(uint32_t frameBuffer, uint32_t size, const uint32_t *buffers);
 		void FrameBufferRenderBuffer(
 			uint32_t frameBuffer,
 			uint32_t attachment,
@@ -433,6 +455,20 @@ namespace Game
 		void* MapBuffer(uint32_t buffer, BufferAccess access) const;
 		void UnMapBuffer(uint32_t buffer) const;
 
+		GLsync FenceSync() const;
+		SyncStatus ClientWaitSync(GLsync sync, uint64_t timeout = 0, bool flush = true) const;
+		void WaitSync(GLsync sync) const;
+		void DeleteSync(GLsync sync) const;
+
+		void CreateQueries(uint32_t target, uint32_t count, uint32_t *queries) const;
+		void DeleteQueries(uint32_t count, const uint32_t *queries) const;
+		void QueryCounter(uint32_t query) const;
+		bool IsQueryResultAvailable(uint32_t query) const;
+		uint64_t GetQueryResult(uint32_t query) const;
+
+		void PushDebugGroup(std::string_view message, uint32_t id = 0) const;
+		void PopDebugGroup() const;
+
 		std::string GetString(uint32_t name) const;
 		std::string GetString(uint32_t name, uint32_t index) const;
 
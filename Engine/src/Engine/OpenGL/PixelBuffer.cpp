@@ -0,0 +1,50 @@
+#include "pch.h"
+#include "Engine/OpenGL/PixelBuffer.h"
+
+namespace Game
+{
+	PixelBuffer::PixelBuffer(size_t size, BufferType type, BufferUsage usage) : BufferObject(type)
+	{
+		ASSERT(type == BufferType::PixelPack || type == BufferType::PixelUnpack, "Invalid pixel buffer type");
+
+		if(type != BufferType::PixelPack && type != BufferType::PixelUnpack)
+			throw std::invalid_argument("Invalid pixel buffer type");
+
+		m_Internals = MakePointer<Internals>();
+		m_Internals->Usage = usage;
+
+		Data(usage, size);
+	}
+
+	void PixelBuffer::Realloc(size_t size, BufferUsage usage)
+	{
+		ASSERT(!IsMapped(), "Unable to reallocate mapped buffer");
+		if(IsMapped())
+			throw std::runtime_error("Unable to reallocate mapped buffer");
+
+		m_Internals->Usage = usage;
+		Data(usage, size);
+	}
+
+	void PixelBuffer::Orphan()
+	{
+		Realloc(Size(), m_Internals->Usage);
+	}
+
+	void* PixelBuffer::Map(BufferAccess access)
+	{
+		if(!m_Internals->Mapped)
+			m_Internals->Mapped = GetFunctions().MapBuffer(ID(), access);
+
+		return m_Internals->Mapped;
+	}
+
+	void PixelBuffer::UnMap()
+	{
+		if(!m_Internals->Mapped)
+			return;
+
+		GetFunctions().UnMapBuffer(ID());
+		m_Internals->Mapped = nullptr;
+	}
+}
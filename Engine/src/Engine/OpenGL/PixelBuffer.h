@@ -0,0 +1,27 @@
+#pragma once
+#include "Engine/OpenGL/BufferObject.h"
+
+namespace Game
+{
+	class PixelBuffer: public BufferObject
+	{
+		struct Internals
+		{
+			BufferUsage Usage = BufferUsage::StreamDraw;
+			void *Mapped = nullptr;
+		};
+
+		Pointer<Internals> m_Internals;
+	public:
+		explicit PixelBuffer(size_t size, BufferType type = BufferType::PixelUnpack, BufferUsage usage = BufferUsage::StreamDraw);
+
+		void Realloc(size_t size, BufferUsage usage = BufferUsage::StreamDraw);
+		void Orphan();
+
+		void* Map(BufferAccess access = BufferAccess::WriteOnly);
+		void UnMap();
+
+		bool IsMapped() const { return m_Internals->Mapped != nullptr; }
+		BufferUsage Usage() const { return m_Internals->Usage; }
+	};
+}
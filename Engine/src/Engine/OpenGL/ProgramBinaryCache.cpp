@@ -0,0 +1,160 @@
+#include "pch.h"
+#include "Engine/OpenGL/ProgramBinaryCache.h"
+
+#include "Engine/OpenGL/OpenGlFunctions.h"
+#include "Engine/Utils/Hash.h"
+
+namespace Game
+{
+	struct ProgramBinaryHeader
+	{
+		uint32_t Magic   = 0;
+		uint32_t Version = 0;
+		uint64_t Driver  = 0;
+		uint32_t Format  = 0;
+		uint32_t Size    = 0;
+	};
+
+	constexpr uint32_t PROGRAM_BINARY_MAGIC   = 0x4E425047; // GPBN
+	constexpr uint32_t PROGRAM_BINARY_VERSION = 1;
+
+	bool ProgramBinaryCache::IsSupported()
+	{
+		static bool s_Checked   = false;
+		static bool s_Supported = false;
+
+		if(!s_Checked)
+		{
+			int formats = 0;
+			OpenGlFunctions::GetFunctions().Get(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+
+			s_Supported = formats > 0;
+			s_Checked   = true;
+
+			GL_LOG_INFO("Program binary formats supported: {}", formats);
+		}
+
+		return s_Supported;
+	}
+
+	uint64_t ProgramBinaryCache::GetDriverHash()
+	{
+		static bool s_Checked   = false;
+		static uint64_t s_Value = 0;
+
+		if(!s_Checked)
+		{
+			auto &functions = OpenGlFunctions::GetFunctions();
+
+			s_Value = Hash(functions.GetStringView(GL_VENDOR));
+			s_Value = Hash(functions.GetStringView(GL_RENDERER), s_Value);
+			s_Value = Hash(functions.GetStringView(GL_VERSION), s_Value);
+
+			s_Checked = true;
+		}
+
+		return s_Value;
+	}
+
+	bool ProgramBinaryCache::Load(uint64_t key, Binary &binary)
+	{
+		const auto path = GetPath(key);
+
+		std::error_code error;
+		if(!std::filesystem::exists(path, error))
+			return false;
+
+		std::ifstream file(path, std::ios::in | std::ios::binary);
+		if(!file.good())
+		{
+			GL_LOG_WARN("Unable to open program binary \"{}\"", path.string());
+			return false;
+		}
+
+		ProgramBinaryHeader header;
+		file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+		if(!file || header.Magic != PROGRAM_BINARY_MAGIC || header.Version != PROGRAM_BINARY_VERSION || header.Driver != GetDriverHash())
+		{
+			GL_LOG_DEBUG("Program binary \"{}\" is stale", path.string());
+			return false;
+		}
+
+		// The binary fills the rest of the file, checked before anything is allocated for it
+		const auto fileSize = std::filesystem::file_size(path, error);
+
+		if(error || header.Size == 0 || header.Size != fileSize - sizeof(header))
+		{
+			GL_LOG_WARN("Program binary \"{}\" does not match its size", path.string());
+			return false;
+		}
+
+		binary.Format = header.Format;
+		binary.Data.resize(header.Size);
+
+		file.read(reinterpret_cast<char*>(binary.Data.data()), header.Size);
+
+		if(file.gcount() != static_cast<std::streamsize>(header.Size))
+		{
+			GL_LOG_WARN("Program binary \"{}\" is truncated", path.string());
+			return false;
+		}
+
+		GL_LOG_DEBUG("Loaded program binary \"{}\" ({} bytes)", path.string(), header.Size);
+		return true;
+	}
+
+	bool ProgramBinaryCache::Save(uint64_t key, const Binary &binary)
+	{
+		if(binary.Data.empty())
+			return false;
+
+		std::error_code error;
+		std::filesystem::create_directories(s_Directory, error);
+
+		if(error)
+		{
+			GL_LOG_WARN("Unable to create program binary cache directory \"{}\": {}", s_Directory.string(), error.message());
+			return false;
+		}
+
+		const auto path = GetPath(key);
+		std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+
+		if(!file.good())
+		{
+			GL_LOG_WARN("Unable to write program binary \"{}\"", path.string());
+			return false;
+		}
+
+		ProgramBinaryHeader header;
+		header.Magic   = PROGRAM_BINARY_MAGIC;
+		header.Version = PROGRAM_BINARY_VERSION;
+		header.Driver  = GetDriverHash();
+		header.Format  = binary.Format;
+		header.Size    = static_cast<uint32_t>(binary.Data.size());
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		file.write(reinterpret_cast<const char*>(binary.Data.data()), binary.Data.size());
+
+		GL_LOG_DEBUG("Saved program binary \"{}\" ({} bytes)", path.string(), header.Size);
+		return file.good();
+	}
+
+	void ProgramBinaryCache::Remove(uint64_t key)
+	{
+		std::error_code error;
+		std::filesystem::remove(GetPath(key), error);
+	}
+
+	void ProgramBinaryCache::Clear()
+	{
+		std::error_code error;
+		std::filesystem::remove_all(s_Directory, error);
+	}
+
+	std::filesystem::path ProgramBinaryCache::GetPath(uint64_t key)
+	{
+		return s_Directory / fmt::format("{:016x}.bin", key);
+	}
+}
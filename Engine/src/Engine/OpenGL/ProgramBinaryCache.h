@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+
+#include <filesystem>
+#include <vector>
+
+namespace Game
+{
+	class ProgramBinaryCache
+	{
+		static inline std::filesystem::path s_Directory = "cache/shaders";
+		static inline bool s_Enabled = true;
+
+	public:
+		struct Binary
+		{
+			uint32_t Format = 0;
+			std::vector<uint8_t> Data;
+		};
+
+		static void SetDirectory(const std::filesystem::path &directory) { s_Directory = directory; }
+		static const std::filesystem::path& GetDirectory() { return s_Directory; }
+
+		static void Enable(bool enabled) { s_Enabled = enabled; }
+		static bool IsEnabled() { return s_Enabled && IsSupported(); }
+
+		static bool IsSupported();
+
+		static uint64_t GetDriverHash();
+
+		static bool Load(uint64_t key, Binary &binary);
+		static bool Save(uint64_t key, const Binary &binary);
+		static void Remove(uint64_t key);
+
+		static void Clear();
+
+	private:
+		static std::filesystem::path GetPath(uint64_t key);
+	};
+}
@@ -0,0 +1,147 @@
+#include "pch.h"
+#include "Engine/OpenGL/RenderTargetPool.h"
+
+#include "Engine/OpenGL/RenderBuffer.h"
+#include "Engine/OpenGL/Texture.h"
+#include "Engine/Utils/Hash.h"
+
+namespace Game
+{
+	size_t RenderTargetDescriptionHash::operator()(const RenderTargetDescription &description) const
+	{
+		uint64_t hash = HashValue(description.Size.Width);
+
+		hash = HashCombine(hash, HashValue(description.Size.Height));
+		hash = HashCombine(hash, HashValue(description.Format));
+		hash = HashCombine(hash, HashValue(description.Samples));
+
+		return static_cast<size_t>(hash);
+	}
+
+	RenderTargetPool::RenderTargetPool(uint32_t maxIdleFrames) : m_MaxIdleFrames(maxIdleFrames) {}
+
+	Ref<Texture> RenderTargetPool::AcquireTexture(const RenderTargetDescription &description)
+	{
+		ASSERT(description.Samples <= 1, "Multisampled textures are not supported, use a render buffer");
+		if(description.Samples > 1)
+			throw std::invalid_argument("Multisampled textures are not supported, use a render buffer");
+
+		return Acquire(
+		               m_Textures,
+		               description,
+		               [&description]()
+		               {
+			               auto texture = MakeRef<Texture>();
+			               texture->TextureObject::Create(description.Size, 1, description.Format);
+
+			               return texture;
+		               }
+		              );
+	}
+
+	Ref<RenderBuffer> RenderTargetPool::AcquireRenderBuffer(const RenderTargetDescription &description)
+	{
+		return Acquire(
+		               m_RenderBuffers,
+		               description,
+		               [&description]() { return MakeRef<RenderBuffer>(description.Size, description.Format, description.Samples); }
+		              );
+	}
+
+	void RenderTargetPool::Update()
+	{
+		++m_Frame;
+
+		Collect(m_Textures);
+		Collect(m_RenderBuffers);
+	}
+
+	void RenderTargetPool::Clear()
+	{
+		m_Textures.clear();
+		m_RenderBuffers.clear();
+	}
+
+	size_t RenderTargetPool::GetTextureCount() const
+	{
+		size_t count = 0;
+		for(const auto &[description, entries] : m_Textures)
+			count += entries.size();
+
+		return count;
+	}
+
+	size_t RenderTargetPool::GetRenderBufferCount() const
+	{
+		size_t count = 0;
+		for(const auto &[description, entries] : m_RenderBuffers)
+			count += entries.size();
+
+		return count;
+	}
+
+	size_t RenderTargetPool::GetInUseCount() const
+	{
+		const auto inUse = [](const auto &map)
+		{
+			size_t count = 0;
+			for(const auto &[description, entries] : map)
+				count += static_cast<size_t>(std::ranges::count_if(entries, [](const auto &entry) { return entry.Target.use_count() > 1; }));
+
+			return count;
+		};
+
+		return inUse(m_Textures) + inUse(m_RenderBuffers);
+	}
+
+	template <typename Type, typename Factory>
+	Ref<Type> RenderTargetPool::Acquire(EntryMap<Type> &entries, const RenderTargetDescription &description, Factory &&factory)
+	{
+		ASSERT(description.Size.Width > 0 && description.Size.Height > 0, "Empty render target");
+		if(description.Size.Width == 0 || description.Size.Height == 0)
+			throw std::invalid_argument("Empty render target");
+
+		auto &bucket = entries[description];
+
+		for(auto &entry : bucket)
+		{
+			if(entry.Target.use_count() == 1)
+			{
+				entry.LastUsed = m_Frame;
+				return entry.Target;
+			}
+		}
+
+		GL_LOG_DEBUG(
+		             "Allocating render target {}x{} (format: {:#x}, samples: {})",
+		             description.Size.Width,
+		             description.Size.Height,
+		             static_cast<uint32_t>(description.Format),
+		             description.Samples
+		            );
+
+		return bucket.emplace_back(Entry<Type>{factory(), m_Frame}).Target;
+	}
+
+	template <typename Type>
+	void RenderTargetPool::Collect(EntryMap<Type> &entries)
+	{
+		for(auto it = entries.begin(); it != entries.end();)
+		{
+			auto &bucket = it->second;
+
+			for(auto &entry : bucket)
+			{
+				if(entry.Target.use_count() > 1)
+					entry.LastUsed = m_Frame;
+			}
+
+			std::erase_if(bucket, [this](const Entry<Type> &entry) { return m_Frame - entry.LastUsed > m_MaxIdleFrames; });
+
+			if(bucket.empty())
+				it = entries.erase(it);
+			else
+				++it;
+		}
+	}
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/Core/Vector2.h"
+#include "Engine/OpenGL/GLEnums.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace Game
+{
+	class Texture;
+	class RenderBuffer;
+
+	struct RenderTargetDescription
+	{
+		Vector2u Size;
+		InternalFormat Format = InternalFormat::RGBA8;
+		uint32_t Samples      = 0;
+
+		bool operator==(const RenderTargetDescription &other) const
+		{
+			return Size == other.Size && Format == other.Format && Samples == other.Samples;
+		}
+
+		bool operator!=(const RenderTargetDescription &other) const { return !(*this == other); }
+	};
+
+	struct RenderTargetDescriptionHash
+	{
+		size_t operator()(const RenderTargetDescription &description) const;
+	};
+
+	// Recycles framebuffer attachments, a target is free again once only the pool holds a reference to it
+	class RenderTargetPool
+	{
+		template <typename Type>
+		struct Entry
+		{
+			Ref<Type> Target;
+			uint64_t LastUsed = 0;
+		};
+
+		template <typename Type>
+		using EntryMap = std::unordered_map<RenderTargetDescription, std::vector<Entry<Type>>, RenderTargetDescriptionHash>;
+
+		EntryMap<Texture> m_Textures;
+		EntryMap<RenderBuffer> m_RenderBuffers;
+
+		uint64_t m_Frame         = 0;
+		uint32_t m_MaxIdleFrames = 0;
+
+	public:
+		explicit RenderTargetPool(uint32_t maxIdleFrames = 3);
+
+		RenderTargetPool(const RenderTargetPool&) = delete;
+		RenderTargetPool& operator=(const RenderTargetPool&) = delete;
+
+		Ref<Texture> AcquireTexture(const RenderTargetDescription &description);
+		Ref<RenderBuffer> AcquireRenderBuffer(const RenderTargetDescription &description);
+
+		// Advances the frame counter and releases targets that were not used for the configured number of frames
+		void Update();
+		void Clear();
+
+		void SetMaxIdleFrames(uint32_t frames) { m_MaxIdleFrames = frames; }
+		uint32_t GetMaxIdleFrames() const { return m_MaxIdleFrames; }
+
+		size_t GetTextureCount() const;
+		size_t GetRenderBufferCount() const;
+		size_t GetInUseCount() const;
+
+	private:
+		template <typename Type, typename Factory>
+		Ref<Type> Acquire(EntryMap<Type> &entries, const RenderTargetDescription &description, Factory &&factory);
+
+		template <typename Type>
+		void Collect(EntryMap<Type> &entries);
+	};
+}
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "Engine/OpenGL/Shader.h"
+#include "Engine/OpenGL/ShaderCompiler.h"
 
 #include "Engine/Renderer/Context.h"
 
@@ -54,11 +55,39 @@ namespace Game
 	}
 
 	bool Shader::Internals::Compile()
+	{
+		SubmitCompile();
+		return FinishCompile();
+	}
+
+	void Shader::Internals::SubmitCompile()
 	{
 		GL_LOG_INFO("Compliling [id: {}] {} Shader", Shader, ShaderTypeToString(Type));
 
 		Functions.CompileShader(Shader);
 
+		Compiled = false;
+		Pending  = true;
+	}
+
+	bool Shader::Internals::IsCompileReady() const
+	{
+		if(!Pending)
+			return true;
+
+		if(!ShaderCompiler::IsParallelSupported())
+			return true;
+
+		return Get(ShaderParameterName::CompletionStatus) == GL_TRUE;
+	}
+
+	bool Shader::Internals::FinishCompile()
+	{
+		if(!Pending)
+			return Compiled;
+
+		Pending = false;
+
 		if (const int status = Get(ShaderParameterName::CompileStatus); status == GL_FALSE)
 		{
 			GL_LOG_ERROR("Unable to compile [id: {}] {} Shader", Shader, ShaderTypeToString(Type));
@@ -79,6 +108,15 @@ namespace Game
 		return Functions.GetShader(Shader, name);
 	}
 
+	void Shader::Internals::Swap(Internals &other)
+	{
+		std::swap(Source, other.Source);
+		std::swap(Type, other.Type);
+		std::swap(Compiled, other.Compiled);
+		std::swap(Pending, other.Pending);
+		std::swap(Shader, other.Shader);
+	}
+
 	Shader::Shader(const Type &type)
 	{
 		ASSERT(type != Type::Unknown, "Unknown Shader Type");
@@ -89,10 +127,12 @@ namespace Game
 		GL_LOG_INFO("{} Shader id: {}", ShaderTypeToString(type), m_Internals->Shader);
 	}
 
-	Shader::Shader(const Type &type, const ShaderSource &source) : Shader(type)
+	Shader::Shader(const Type &type, const ShaderSource &source, bool compile) : Shader(type)
 	{
 		SetSource(source);
-		Compile();
+
+		if(compile)
+			Compile();
 	}
 
 	std::string_view Shader::TypeToString() const
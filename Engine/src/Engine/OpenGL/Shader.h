@@ -13,6 +13,8 @@ namespace Game
 {
 	class Shader
 	{
+		friend class ShaderReloader;
+
 	public:
 		enum class Type : uint32_t
 		{
@@ -35,6 +37,7 @@ namespace Game
 
 			Type Type = Type::Unknown;
 			bool Compiled = false;
+			bool Pending  = false;
 			IDType Shader = 0;
 
 			mutable OpenGlFunctions Functions;
@@ -46,20 +49,31 @@ namespace Game
 			void SetSource(const ShaderSource& source);
 			bool Compile();
 
+			void SubmitCompile();
+			bool IsCompileReady() const;
+			bool FinishCompile();
+
 			std::string GetLog() const;
 
 			int Get(ShaderParameterName name) const;
+
+			void Swap(Internals &other);
 		};
 
 		Pointer<Internals> m_Internals;
 
 	public:
 		explicit Shader(const Type& type);
-		Shader(const Type &type, const ShaderSource& source);
+		Shader(const Type &type, const ShaderSource& source, bool compile = true);
 
 		bool Compile() { return m_Internals->Compile(); }
 		bool IsCompiled() const { return m_Internals->Compiled; }
 
+		void SubmitCompile() { m_Internals->SubmitCompile(); }
+		bool IsCompilePending() const { return m_Internals->Pending; }
+		bool IsCompileReady() const { return m_Internals->IsCompileReady(); }
+		bool FinishCompile() { return m_Internals->FinishCompile(); }
+
 		void SetSource(const ShaderSource &source) { m_Internals->SetSource(source); }
 		const ShaderSource& GetSource() const { return m_Internals->Source; }
 
@@ -82,7 +96,7 @@ namespace Game
 	public:\
 		type##Shader() : Shader(Shader::Type::type) {}\
 		\
-		type##Shader(const ShaderSource& source) : Shader(Shader::Type::type, source){}\
+		type##Shader(const ShaderSource& source, bool compile = true) : Shader(Shader::Type::type, source, compile){}\
 		\
 	}
 
@@ -0,0 +1,64 @@
+#include "pch.h"
+#include "Engine/OpenGL/ShaderCache.h"
+
+#include "Engine/OpenGL/ShaderPreprocessor.h"
+
+namespace Game
+{
+	uint64_t ShaderCache::GetKey(Shader::Type type, const ShaderSource &source, const ShaderDefines &defines)
+	{
+		return CalculateKey(type, ShaderPreprocessor::Process(source, defines));
+	}
+
+	uint64_t ShaderCache::GetKey(Shader::Type type, const std::filesystem::path &path, const ShaderDefines &defines)
+	{
+		return CalculateKey(type, ShaderPreprocessor::Load(path, defines));
+	}
+
+	Ref<Shader> ShaderCache::Get(Shader::Type type, const ShaderSource &source, const ShaderDefines &defines)
+	{
+		return Find(type, ShaderPreprocessor::Process(source, defines));
+	}
+
+	Ref<Shader> ShaderCache::Load(Shader::Type type, const std::filesystem::path &path, const ShaderDefines &defines)
+	{
+		return Find(type, ShaderPreprocessor::Load(path, defines));
+	}
+
+	void ShaderCache::Invalidate(const std::filesystem::path &path)
+	{
+		const auto removed = std::erase_if(s_Shaders, [&path](const auto &entry) { return entry.second->GetSource().DependsOn(path); });
+
+		if(removed)
+			GL_LOG_DEBUG("Dropped {} cached shader permutations depending on \"{}\"", removed, path.string());
+	}
+
+	uint64_t ShaderCache::CalculateKey(Shader::Type type, const ShaderSource &processed)
+	{
+		// The expanded text holds every include and the injected defines, an edit to any of them changes the key
+		const uint64_t key = HashCombine(Hash(processed.Source()), static_cast<uint64_t>(type));
+		return ShaderPreprocessor::HashDefines(processed.Defines(), key);
+	}
+
+	Ref<Shader> ShaderCache::Find(Shader::Type type, const ShaderSource &processed)
+	{
+		const uint64_t key = CalculateKey(type, processed);
+
+		if(const auto it = s_Shaders.find(key); it != s_Shaders.end())
+			return it->second;
+
+		return Create(key, type, processed);
+	}
+
+	Ref<Shader> ShaderCache::Create(uint64_t key, Shader::Type type, const ShaderSource &source)
+	{
+		GL_LOG_DEBUG("Creating {} shader permutation {:016x}", Shader::TypeToString(type), key);
+
+		// Compilation is only submitted, the program link or ShaderCompiler collects the result
+		auto shader = MakeRef<Shader>(type, source, false);
+		shader->SubmitCompile();
+
+		s_Shaders.emplace(key, shader);
+		return shader;
+	}
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/OpenGL/Shader.h"
+#include "Engine/OpenGL/ShaderSource.h"
+#include "Engine/Utils/Hash.h"
+
+#include <filesystem>
+#include <unordered_map>
+
+namespace Game
+{
+	// Shaders keyed by their preprocessed text, every lookup runs the preprocessor and its file cache decides what is reread
+	class ShaderCache
+	{
+		static inline std::unordered_map<uint64_t, Ref<Shader>, IdentityHash> s_Shaders;
+
+	public:
+		static uint64_t GetKey(Shader::Type type, const ShaderSource &source, const ShaderDefines &defines = {});
+		static uint64_t GetKey(Shader::Type type, const std::filesystem::path &path, const ShaderDefines &defines = {});
+
+		static Ref<Shader> Get(Shader::Type type, const ShaderSource &source, const ShaderDefines &defines = {});
+		static Ref<Shader> Load(Shader::Type type, const std::filesystem::path &path, const ShaderDefines &defines = {});
+
+		static bool Contains(uint64_t key) { return s_Shaders.contains(key); }
+		static void Remove(uint64_t key) { s_Shaders.erase(key); }
+
+		// Drops every permutation built from the file or including it, ShaderReloader calls it for changed files
+		static void Invalidate(const std::filesystem::path &path);
+
+		static void Clear() { s_Shaders.clear(); }
+		static size_t Size() { return s_Shaders.size(); }
+
+	private:
+		static uint64_t CalculateKey(Shader::Type type, const ShaderSource &processed);
+
+		static Ref<Shader> Find(Shader::Type type, const ShaderSource &processed);
+		static Ref<Shader> Create(uint64_t key, Shader::Type type, const ShaderSource &source);
+	};
+}
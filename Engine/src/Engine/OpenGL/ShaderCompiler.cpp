@@ -0,0 +1,183 @@
+#include "pch.h"
+#include "Engine/OpenGL/ShaderCompiler.h"
+
+#include "Engine/OpenGL/ShaderProgram.h"
+#include "Engine/OpenGL/ShaderReloader.h"
+#include "Engine/Renderer/Context.h"
+
+#include <GLFW/glfw3.h>
+
+namespace Game
+{
+	typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC_)(GLuint count);
+
+	bool ShaderCompiler::IsParallelSupported()
+	{
+		static bool s_Checked   = false;
+		static bool s_Supported = false;
+
+		if(!s_Checked)
+		{
+			const auto context = Context::GetContext();
+			ASSERT(context, "No current context");
+
+			if(context)
+			{
+				s_Supported = context->IsExtensionSupported("GL_KHR_parallel_shader_compile") ||
+				              context->IsExtensionSupported("GL_ARB_parallel_shader_compile");
+				s_Checked = true;
+
+				GL_LOG_INFO("Parallel shader compilation supported: {}", s_Supported);
+			}
+		}
+
+		return s_Supported;
+	}
+
+	void ShaderCompiler::SetMaxThreads(uint32_t count)
+	{
+		if(!IsParallelSupported())
+			return;
+
+		auto function = reinterpret_cast<PFNGLMAXSHADERCOMPILERTHREADSKHRPROC_>(glfwGetProcAddress("glMaxShaderCompilerThreadsKHR"));
+
+		if(!function)
+			function = reinterpret_cast<PFNGLMAXSHADERCOMPILERTHREADSKHRPROC_>(glfwGetProcAddress("glMaxShaderCompilerThreadsARB"));
+
+		if(!function)
+		{
+			GL_LOG_WARN("Unable to load glMaxShaderCompilerThreadsKHR");
+			return;
+		}
+
+		function(count);
+		GL_LOG_DEBUG("Max shader compiler threads set to {}", count);
+	}
+
+	std::shared_future<bool> ShaderCompiler::Submit(Ref<ShaderProgram> program, Callback callback)
+	{
+		static bool s_Initialized = false;
+
+		if(!s_Initialized)
+		{
+			SetMaxThreads(0xFFFFFFFF);
+			s_Initialized = true;
+		}
+
+		ASSERT(program, "Submitting null shader program");
+		if(!program)
+			throw std::runtime_error("Submitting null shader program");
+
+		auto job        = MakePointer<Job>();
+		job->Program    = program;
+		job->OnComplete = std::move(callback);
+
+		std::shared_future<bool> future = job->Promise.get_future().share();
+
+		auto &internals   = *program->m_Internals;
+		internals.Linked  = false;
+		internals.Pending = false;
+
+		if(internals.LoadCachedBinary())
+		{
+			internals.Linked = true;
+			Complete(*job, true);
+			Notify(*job);
+			return future;
+		}
+
+		for(const auto &shader : internals.Shaders)
+		{
+			if(!shader->IsCompiled() && !shader->IsCompilePending())
+				shader->SubmitCompile();
+		}
+
+		s_Jobs.emplace_back(std::move(job));
+		return future;
+	}
+
+	void ShaderCompiler::Poll()
+	{
+		if(s_Jobs.empty())
+			return;
+
+		std::vector<Pointer<Job>> completed;
+
+		std::erase_if(
+		              s_Jobs,
+		              [&completed](const Pointer<Job> &job)
+		              {
+			              if(!Advance(*job, false))
+				              return false;
+
+			              completed.emplace_back(job);
+			              return true;
+		              }
+		             );
+
+		for(const auto &job : completed)
+			Notify(*job);
+	}
+
+	void ShaderCompiler::Wait()
+	{
+		auto jobs = std::move(s_Jobs);
+		s_Jobs.clear();
+
+		for(auto &job : jobs)
+		{
+			while(!Advance(*job, true));
+			Notify(*job);
+		}
+	}
+
+	bool ShaderCompiler::Advance(Job &job, bool wait)
+	{
+		auto &internals = *job.Program->m_Internals;
+
+		if(job.State == Stage::Compiling)
+		{
+			if(!wait)
+			{
+				for(const auto &shader : internals.Shaders)
+				{
+					if(!shader->IsCompileReady())
+						return false;
+				}
+			}
+
+			if(!internals.SubmitSourceLink())
+			{
+				Complete(job, false);
+				return true;
+			}
+
+			job.State = Stage::Linking;
+
+			// Without the extension the status query would stall here, leave it for the next poll
+			if(!wait && !IsParallelSupported())
+				return false;
+		}
+
+		if(!wait && !internals.IsLinkReady())
+			return false;
+
+		Complete(job, internals.FinishLink());
+		return true;
+	}
+
+	void ShaderCompiler::Complete(Job &job, bool status)
+	{
+		job.Status = status;
+		job.Promise.set_value(status);
+
+		if(status)
+			ShaderReloader::Register(*job.Program);
+	}
+
+	void ShaderCompiler::Notify(const Job &job)
+	{
+		if(job.OnComplete)
+			job.OnComplete(job.Program, job.Status);
+	}
+}
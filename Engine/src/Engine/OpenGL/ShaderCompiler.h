@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+
+#include <functional>
+#include <future>
+#include <vector>
+
+namespace Game
+{
+	class ShaderProgram;
+
+	class ShaderCompiler
+	{
+	public:
+		using Callback = std::function<void(Ref<ShaderProgram>, bool)>;
+
+	private:
+		enum class Stage
+		{
+			Compiling,
+			Linking
+		};
+
+		struct Job
+		{
+			Ref<ShaderProgram> Program;
+			Stage State = Stage::Compiling;
+			bool Status = false;
+
+			std::promise<bool> Promise;
+			Callback OnComplete;
+		};
+
+		static inline std::vector<Pointer<Job>> s_Jobs;
+
+	public:
+		static bool IsParallelSupported();
+		static void SetMaxThreads(uint32_t count);
+
+		static std::shared_future<bool> Submit(Ref<ShaderProgram> program, Callback callback = nullptr);
+
+		static void Poll();
+		static void Wait();
+
+		static size_t GetPendingCount() { return s_Jobs.size(); }
+
+	private:
+		static bool Advance(Job &job, bool wait);
+		static void Complete(Job &job, bool status);
+		static void Notify(const Job &job);
+	};
+}
@@ -0,0 +1,304 @@
+#include "pch.h"
+#include "Engine/OpenGL/ShaderPreprocessor.h"
+
+#include "Engine/Utils/Hash.h"
+
+#include <sstream>
+
+namespace Game
+{
+	static std::string_view TrimView(std::string_view string)
+	{
+		const auto begin = string.find_first_not_of(" \t\r");
+		if(begin == std::string_view::npos)
+			return {};
+
+		const auto end = string.find_last_not_of(" \t\r");
+		return string.substr(begin, end - begin + 1);
+	}
+
+	static bool ParseDirective(std::string_view line, std::string_view directive, std::string_view &argument)
+	{
+		line = TrimView(line);
+
+		if(line.empty() || line.front() != '#')
+			return false;
+
+		line = TrimView(line.substr(1));
+
+		if(!line.starts_with(directive))
+			return false;
+
+		argument = TrimView(line.substr(directive.size()));
+		return true;
+	}
+
+	static bool ParseInclude(std::string_view line, std::string &name)
+	{
+		std::string_view argument;
+
+		if(!ParseDirective(line, "include", argument) || argument.size() < 2)
+			return false;
+
+		const char close = argument.front() == '"' ? '"' : argument.front() == '<' ? '>' : 0;
+
+		if(!close)
+			return false;
+
+		const auto end = argument.find(close, 1);
+		if(end == std::string_view::npos)
+			return false;
+
+		name = std::string(argument.substr(1, end - 1));
+		return true;
+	}
+
+	void ShaderPreprocessor::AddIncludePath(const std::filesystem::path &path)
+	{
+		std::scoped_lock lock(s_Mutex);
+
+		if(std::ranges::find(s_IncludePaths, path) == s_IncludePaths.end())
+			s_IncludePaths.emplace_back(path);
+	}
+
+	void ShaderPreprocessor::ClearIncludePaths()
+	{
+		std::scoped_lock lock(s_Mutex);
+		s_IncludePaths.clear();
+	}
+
+	ShaderSource ShaderPreprocessor::Load(const std::filesystem::path &path, const ShaderDefines &defines)
+	{
+		LOG_DEBUG("Preprocessing Shader source from: \"{}\"", path.string());
+
+		const auto file = GetFile(path);
+
+		if(!file)
+		{
+			LOG_ERROR("Unable to open and load \"{}\"", path.string());
+			return ShaderSource("");
+		}
+
+		Context context;
+		context.Stack.emplace_back(file->Path);
+		context.Included.emplace(file->Path.string());
+
+		Expand(context, *file, 0);
+		InjectDefines(context.Output, defines);
+
+		ShaderSource source(context.Output);
+		source.Path(file->Path);
+		source.Dependencies(std::move(context.Dependencies));
+		source.Defines(defines);
+
+		return source;
+	}
+
+	ShaderSource ShaderPreprocessor::Process(const ShaderSource &source, const ShaderDefines &defines)
+	{
+		if(!source.Path().empty())
+			return Load(source.Path(), defines);
+
+		const auto file = Parse(source.Source());
+
+		Context context;
+		Expand(context, *file, 0);
+		InjectDefines(context.Output, defines);
+
+		ShaderSource result(context.Output);
+		result.Dependencies(std::move(context.Dependencies));
+		result.Defines(defines);
+
+		return result;
+	}
+
+	uint64_t ShaderPreprocessor::HashDefines(const ShaderDefines &defines, uint64_t seed)
+	{
+		uint64_t hash = seed;
+
+		for(const auto &[name, value] : defines)
+		{
+			hash = HashCombine(hash, Hash(name));
+			hash = HashCombine(hash, Hash(value));
+		}
+
+		return hash;
+	}
+
+	void ShaderPreprocessor::Invalidate(const std::filesystem::path &path)
+	{
+		std::error_code error;
+		auto canonical = std::filesystem::weakly_canonical(path, error);
+
+		std::scoped_lock lock(s_Mutex);
+		s_Files.erase((error ? path : canonical).string());
+	}
+
+	void ShaderPreprocessor::ClearCache()
+	{
+		std::scoped_lock lock(s_Mutex);
+		s_Files.clear();
+	}
+
+	Pointer<ShaderPreprocessor::File> ShaderPreprocessor::GetFile(const std::filesystem::path &path)
+	{
+		std::error_code error;
+		const auto canonical = std::filesystem::weakly_canonical(path, error);
+		const auto key       = (error ? path : canonical).string();
+		const auto time      = std::filesystem::last_write_time(path, error);
+
+		if(error)
+			return nullptr;
+
+		{
+			std::scoped_lock lock(s_Mutex);
+
+			const auto it = s_Files.find(key);
+			if(it != s_Files.end() && it->second->Time == time)
+				return it->second;
+		}
+
+		std::ifstream stream(path, std::ios::in);
+		if(!stream.good())
+			return nullptr;
+
+		std::stringstream text;
+		text << stream.rdbuf();
+
+		auto file  = Parse(text.str());
+		file->Path = key;
+		file->Time = time;
+
+		std::scoped_lock lock(s_Mutex);
+		s_Files[key] = file;
+
+		return file;
+	}
+
+	Pointer<ShaderPreprocessor::File> ShaderPreprocessor::Parse(const std::string &text)
+	{
+		auto file = MakePointer<File>();
+
+		std::istringstream stream(text);
+		std::string line;
+
+		while(std::getline(stream, line))
+		{
+			std::string_view argument;
+
+			if(ParseDirective(line, "pragma", argument) && argument == "once")
+			{
+				file->Once = true;
+				line.clear();
+			}
+
+			file->Lines.emplace_back(std::move(line));
+		}
+
+		return file;
+	}
+
+	std::filesystem::path ShaderPreprocessor::Resolve(const std::string &name, const std::filesystem::path &directory)
+	{
+		std::error_code error;
+
+		if(!directory.empty() && std::filesystem::exists(directory / name, error))
+			return directory / name;
+
+		std::scoped_lock lock(s_Mutex);
+
+		for(const auto &includePath : s_IncludePaths)
+		{
+			if(std::filesystem::exists(includePath / name, error))
+				return includePath / name;
+		}
+
+		return {};
+	}
+
+	void ShaderPreprocessor::Expand(Context &context, const File &file, uint32_t sourceIndex)
+	{
+		const auto directory = file.Path.parent_path();
+
+		for(size_t i = 0; i < file.Lines.size(); ++i)
+		{
+			const auto &line = file.Lines[i];
+			std::string name;
+
+			if(!ParseInclude(line, name))
+			{
+				context.Output.append(line);
+				context.Output.push_back('\n');
+				continue;
+			}
+
+			const auto path = Resolve(name, directory);
+			const auto include = path.empty() ? nullptr : GetFile(path);
+
+			if(!include)
+			{
+				LOG_ERROR("Unable to resolve shader include \"{}\" in \"{}\"", name, file.Path.string());
+				context.Output.append(fmt::format("#error Unable to resolve include \"{}\"\n", name));
+				continue;
+			}
+
+			if(std::ranges::find(context.Stack, include->Path) != context.Stack.end())
+			{
+				LOG_ERROR("Recursive shader include \"{}\" in \"{}\"", name, file.Path.string());
+				context.Output.append(fmt::format("#error Recursive include \"{}\"\n", name));
+				continue;
+			}
+
+			const bool included = !context.Included.emplace(include->Path.string()).second;
+
+			auto dependency = std::ranges::find(context.Dependencies, include->Path);
+			if(dependency == context.Dependencies.end())
+				dependency = context.Dependencies.emplace(dependency, include->Path);
+
+			if(included && include->Once)
+			{
+				context.Output.push_back('\n');
+				continue;
+			}
+
+			// Source string 0 is the top level file, dependencies follow in the order they were first seen
+			const auto includeIndex = static_cast<uint32_t>(std::distance(context.Dependencies.begin(), dependency)) + 1;
+
+			context.Stack.emplace_back(include->Path);
+			context.Output.append(fmt::format("#line 1 {}\n", includeIndex));
+
+			Expand(context, *include, includeIndex);
+
+			context.Output.append(fmt::format("#line {} {}\n", i + 2, sourceIndex));
+			context.Stack.pop_back();
+		}
+	}
+
+	void ShaderPreprocessor::InjectDefines(std::string &output, const ShaderDefines &defines)
+	{
+		if(defines.empty())
+			return;
+
+		std::string block;
+		for(const auto &[name, value] : defines)
+			block.append(value.empty() ? fmt::format("#define {}\n", name) : fmt::format("#define {} {}\n", name, value));
+
+		// Defines have to follow #version, which must stay the first directive
+		size_t position = 0;
+		const auto version = output.find("#version");
+
+		if(version != std::string::npos)
+		{
+			const auto end = output.find('\n', version);
+			position       = end == std::string::npos ? output.size() : end + 1;
+		}
+
+		if(position == output.size() && (output.empty() || output.back() != '\n'))
+			block.insert(block.begin(), '\n');
+
+		const auto line = std::count(output.begin(), output.begin() + position, '\n') + 1;
+		block.append(fmt::format("#line {} 0\n", line));
+
+		output.insert(position, block);
+	}
+}
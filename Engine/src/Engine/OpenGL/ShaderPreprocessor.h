@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/OpenGL/ShaderSource.h"
+
+#include <filesystem>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace Game
+{
+	class ShaderPreprocessor
+	{
+		struct File
+		{
+			std::filesystem::path Path;
+			std::filesystem::file_time_type Time;
+
+			std::vector<std::string> Lines;
+			bool Once = false;
+		};
+
+		struct Context
+		{
+			std::vector<std::filesystem::path> Stack;
+			std::unordered_set<std::string> Included;
+			std::vector<std::filesystem::path> Dependencies;
+
+			std::string Output;
+		};
+
+		static inline std::vector<std::filesystem::path> s_IncludePaths;
+		static inline std::unordered_map<std::string, Pointer<File>> s_Files;
+		static inline std::mutex s_Mutex;
+
+	public:
+		static void AddIncludePath(const std::filesystem::path &path);
+		static void ClearIncludePaths();
+		static const std::vector<std::filesystem::path>& GetIncludePaths() { return s_IncludePaths; }
+
+		static ShaderSource Load(const std::filesystem::path &path, const ShaderDefines &defines = {});
+		static ShaderSource Process(const ShaderSource &source, const ShaderDefines &defines = {});
+
+		static uint64_t HashDefines(const ShaderDefines &defines, uint64_t seed = 0);
+
+		static void Invalidate(const std::filesystem::path &path);
+		static void ClearCache();
+
+	private:
+		static Pointer<File> GetFile(const std::filesystem::path &path);
+		static Pointer<File> Parse(const std::string &text);
+
+		static std::filesystem::path Resolve(const std::string &name, const std::filesystem::path &directory);
+
+		static void Expand(Context &context, const File &file, uint32_t sourceIndex);
+		static void InjectDefines(std::string &output, const ShaderDefines &defines);
+	};
+}
@@ -3,14 +3,80 @@
 
 #include "Engine/OpenGL/UniformBuffer.h"
 #include "Engine/OpenGL/Texture.h"
+#include "Engine/OpenGL/ProgramBinaryCache.h"
+#include "Engine/OpenGL/ShaderCompiler.h"
+#include "Engine/OpenGL/ShaderReloader.h"
 
 #include "Engine/Core/Assert.h"
 #include "Engine/Core/Log.h"
 
+#include "Engine/Utils/Hash.h"
+
 #include <glm/gtc/type_ptr.hpp>
 
 namespace Game
 {
+	static constexpr size_t UniformTypeSize(UniformType type)
+	{
+		switch(type)
+		{
+			case UniformType::Float:
+			case UniformType::Int:
+			case UniformType::UInt:
+			case UniformType::Bool:
+			case UniformType::Sampler1D:
+			case UniformType::Sampler2D:
+			case UniformType::Sampler3D:
+			case UniformType::SamplerCube:
+			case UniformType::Sampler2DShadow:
+			case UniformType::Sampler2DArray:
+			case UniformType::Sampler2DArrayShadow:
+			case UniformType::SamplerCubeShadow:
+			case UniformType::Sampler2DMultisample:
+			case UniformType::SamplerBuffer:
+			case UniformType::ISampler2D:
+			case UniformType::USampler2D:
+			case UniformType::Image2D:
+				return 4;
+			case UniformType::Vec2:
+			case UniformType::IVec2:
+			case UniformType::UVec2:
+			case UniformType::BVec2:
+			case UniformType::Double:
+				return 8;
+			case UniformType::Vec3:
+			case UniformType::IVec3:
+			case UniformType::UVec3:
+			case UniformType::BVec3:
+				return 12;
+			case UniformType::Vec4:
+			case UniformType::IVec4:
+			case UniformType::UVec4:
+			case UniformType::BVec4:
+			case UniformType::DVec2:
+			case UniformType::Mat2:
+				return 16;
+			case UniformType::DVec3:
+			case UniformType::Mat2x3:
+			case UniformType::Mat3x2:
+				return 24;
+			case UniformType::DVec4:
+			case UniformType::Mat2x4:
+			case UniformType::Mat4x2:
+				return 32;
+			case UniformType::Mat3:
+				return 36;
+			case UniformType::Mat3x4:
+			case UniformType::Mat4x3:
+				return 48;
+			case UniformType::Mat4:
+				return 64;
+			default:
+				ASSERT(false, "Uniform type without a cache size");
+				return 0;
+		}
+	}
+
 	ShaderProgram::Internals::Internals(std::string name) : Name(std::move(name))
 	{
 		Program = glCreateProgram();
@@ -102,10 +168,77 @@ namespace Game
 
 	bool ShaderProgram::Internals::Link()
 	{
+		if(!SubmitLink())
+			return false;
+
+		return FinishLink();
+	}
+
+	bool ShaderProgram::Internals::SubmitLink()
+	{
+		Linked  = false;
+		Pending = false;
+
+		if(LoadCachedBinary())
+			return Linked = true;
+
+		for(const auto &shader : Shaders)
+		{
+			if(!shader->IsCompiled() && !shader->IsCompilePending())
+				shader->SubmitCompile();
+		}
+
+		return SubmitSourceLink();
+	}
+
+	bool ShaderProgram::Internals::LoadCachedBinary()
+	{
+		if(!ProgramBinaryCache::IsEnabled())
+			return false;
+
+		BinaryKey = GetBinaryKey();
+		return LoadBinary(BinaryKey);
+	}
+
+	bool ShaderProgram::Internals::SubmitSourceLink()
+	{
+		for(const auto &shader : Shaders)
+		{
+			if(!shader->FinishCompile())
+			{
+				GL_LOG_ERROR("Unable to link {} (id: {}) Shader progarm, {} shader failed to compile", Name, Program, shader->TypeToString());
+				return false;
+			}
+		}
+
 		GL_LOG_INFO("Linking {} (id: {}) shader program", Name, Program);
 
+		if(ProgramBinaryCache::IsEnabled())
+			glProgramParameteri(Program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
 		glLinkProgram(Program);
 
+		return Pending = true;
+	}
+
+	bool ShaderProgram::Internals::IsLinkReady() const
+	{
+		if(!Pending)
+			return true;
+
+		if(!ShaderCompiler::IsParallelSupported())
+			return true;
+
+		return Get(ParametersName::CompletionStatus) == GL_TRUE;
+	}
+
+	bool ShaderProgram::Internals::FinishLink()
+	{
+		if(!Pending)
+			return Linked;
+
+		Pending = false;
+
 		if(Get(ParametersName::LinkStatus) == GL_FALSE)
 		{
 			GL_LOG_ERROR("Unable to link {} (id: {}) Shader progarm", Name, Program);
@@ -115,9 +248,72 @@ namespace Game
 		GL_LOG_INFO("Sucessful linked {} (id: {}) shader progarm", Name, Program);
 
 		Populate();
+
+		if(ProgramBinaryCache::IsEnabled())
+			SaveBinary(BinaryKey);
+
 		return Linked = true;
 	}
 
+	uint64_t ShaderProgram::Internals::GetBinaryKey() const
+	{
+		std::vector<Ref<Shader>> shaders(Shaders.begin(), Shaders.end());
+
+		std::ranges::sort(
+		                  shaders,
+		                  [](const Ref<Shader> &a, const Ref<Shader> &b) { return a->GetType() < b->GetType(); }
+		                 );
+
+		uint64_t key = ProgramBinaryCache::GetDriverHash();
+
+		for(const auto &shader : shaders)
+		{
+			key = HashCombine(key, static_cast<uint64_t>(shader->GetType()));
+			key = HashCombine(key, Hash(shader->GetSource().Source()));
+		}
+
+		return key;
+	}
+
+	bool ShaderProgram::Internals::LoadBinary(uint64_t key)
+	{
+		ProgramBinaryCache::Binary binary;
+
+		if(!ProgramBinaryCache::Load(key, binary))
+			return false;
+
+		glProgramBinary(Program, binary.Format, binary.Data.data(), static_cast<GLsizei>(binary.Data.size()));
+
+		if(Get(ParametersName::LinkStatus) == GL_FALSE)
+		{
+			GL_LOG_WARN("Driver rejected cached binary for {} (id: {}) shader program, linking from source", Name, Program);
+			ProgramBinaryCache::Remove(key);
+			return false;
+		}
+
+		GL_LOG_INFO("Loaded {} (id: {}) shader program from binary cache", Name, Program);
+
+		Populate();
+		return true;
+	}
+
+	void ShaderProgram::Internals::SaveBinary(uint64_t key) const
+	{
+		const int length = Get(ParametersName::BinaryLength);
+
+		if(length <= 0)
+			return;
+
+		ProgramBinaryCache::Binary binary;
+		binary.Data.resize(static_cast<size_t>(length));
+
+		GLenum format = 0;
+		glGetProgramBinary(Program, length, nullptr, &format, binary.Data.data());
+		binary.Format = format;
+
+		ProgramBinaryCache::Save(key, binary);
+	}
+
 	void ShaderProgram::Internals::Use() const
 	{
 		if(!Linked)
@@ -167,7 +363,7 @@ namespace Game
 		if(it != UniformsLocation.end())
 			location = it->second;
 		else
-			location = Attributes.emplace(name, glGetUniformLocation(Program, name.c_str())).first->second;
+			location = UniformsLocation.emplace(name, glGetUniformLocation(Program, name.c_str())).first->second;
 
 		return location;
 	}
@@ -180,11 +376,31 @@ namespace Game
 		if(it != UniformBlocksIndex.end())
 			index = it->second;
 		else
-			index = Attributes.emplace(name, glGetUniformBlockIndex(Program, name.c_str())).first->second;
+			index = UniformBlocksIndex.emplace(name, glGetUniformBlockIndex(Program, name.c_str())).first->second;
 
 		return index;
 	}
 
+	ShaderProgram::UniformLocationType ShaderProgram::Internals::GetUniformLocation(HashedString name) const
+	{
+		const auto it = UniformSlots.find(name.Value());
+
+		if(it == UniformSlots.end())
+			return INVALID_UNIFORM_LOCATION;
+
+		return ActiveUniforms[it->second].Location;
+	}
+
+	ShaderProgram::UniformBlockIndexType ShaderProgram::Internals::GetUniformBlockIndex(HashedString name) const
+	{
+		const auto it = UniformBlockSlots.find(name.Value());
+
+		if(it == UniformBlockSlots.end())
+			return INVALID_UNIFORM_BLOCK_INDEX;
+
+		return ActiveUniformBlocks[it->second].Index;
+	}
+
 	int ShaderProgram::Internals::Get(ParametersName name) const
 	{
 		int value = 0;
@@ -211,15 +427,18 @@ namespace Game
 
 		UniformBlocksIndex.clear();
 		ActiveUniformBlocks.clear();
+		UniformBlockSlots.clear();
 
 		UniformBlocksIndex.reserve(count);
 		ActiveUniformBlocks.reserve(count);
+		UniformBlockSlots.reserve(count);
 
 		for(uint32_t i = 0; i < count; ++i)
 		{
 			const auto info = QueryUniformBlock(i);
 			ActiveUniformBlocks.emplace_back(info);
 			UniformBlocksIndex.emplace(info.Name, info.Index);
+			UniformBlockSlots.emplace(HashedString(info.Name).Value(), i);
 
 			GL_LOG_TRACE(
 			             "UniformBlock: {}, Name: {}, Size: {}, Index: {}, ReferedBy: {}",
@@ -239,17 +458,29 @@ namespace Game
 
 		ActiveUniforms.clear();
 		UniformsLocation.clear();
+		UniformSlots.clear();
 
 		ActiveUniforms.reserve(count);
 		UniformsLocation.reserve(count);
+		UniformSlots.reserve(count);
 
 		for(uint32_t i = 0; i < count; ++i)
 		{
 			const auto info = QueryUniform(i);
 
 			UniformsLocation.emplace(info.Name, info.Location);
+			UniformSlots.emplace(HashedString(info.Name).Value(), i);
 			ActiveUniforms.emplace_back(info);
 
+			// Arrays are reported as "name[0]", allow them to be looked up by plain name too
+			if(info.Name.ends_with("[0]"))
+			{
+				const auto name = info.Name.substr(0, info.Name.size() - 3);
+
+				UniformsLocation.emplace(name, info.Location);
+				UniformSlots.emplace(HashedString(name).Value(), i);
+			}
+
 			GL_LOG_TRACE(
 			             "Uniform {}, Name: {}, Size: {}, Type: {}, Location: {}",
 			             i,
@@ -259,6 +490,88 @@ namespace Game
 			             info.Location
 			            );
 		}
+
+		PopulateUniformCache();
+	}
+
+	void ShaderProgram::Internals::PopulateUniformCache()
+	{
+		LocationSlots.clear();
+		UniformCache.clear();
+		UniformValues.clear();
+
+		UniformCache.reserve(ActiveUniforms.size());
+
+		size_t offset = 0;
+		for(uint32_t i = 0; i < ActiveUniforms.size(); ++i)
+		{
+			const auto &info = ActiveUniforms[i];
+
+			UniformCacheEntry entry;
+			entry.Offset = offset;
+			entry.Size   = UniformTypeSize(info.Type) * static_cast<size_t>(std::max(info.Size, 1));
+
+			UniformCache.emplace_back(entry);
+			offset += entry.Size;
+
+			if(info.Location < 0)
+				continue;
+
+			if(LocationSlots.size() <= static_cast<size_t>(info.Location))
+				LocationSlots.resize(static_cast<size_t>(info.Location) + 1, -1);
+
+			LocationSlots[info.Location] = static_cast<int32_t>(i);
+		}
+
+		UniformValues.resize(offset);
+	}
+
+	bool ShaderProgram::Internals::UpdateUniformCache(UniformLocationType location, const void *data, size_t size)
+	{
+		if(location < 0 || static_cast<size_t>(location) >= LocationSlots.size() || LocationSlots[location] < 0)
+		{
+			++s_IssuedUploads;
+			return true;
+		}
+
+		auto &entry = UniformCache[LocationSlots[location]];
+
+		// Types the cache has no size for are never compared
+		if(entry.Size == 0)
+		{
+			++s_IssuedUploads;
+			return true;
+		}
+
+		size = std::min(size, entry.Size);
+
+		uint8_t *value = UniformValues.data() + entry.Offset;
+
+		if(entry.Valid && std::memcmp(value, data, size) == 0)
+		{
+			++s_ElidedUploads;
+			return false;
+		}
+
+		std::memcpy(value, data, size);
+		entry.Valid = true;
+
+		++s_IssuedUploads;
+		return true;
+	}
+
+	bool ShaderProgram::Internals::ShouldUploadMatrix(UniformLocationType location, const void *data, size_t size, bool transpose)
+	{
+		// The cache compares column major values, a transposed upload always goes through and drops the cached one
+		if(!transpose)
+			return UpdateUniformCache(location, data, size);
+
+		++s_IssuedUploads;
+
+		if(location >= 0 && static_cast<size_t>(location) < LocationSlots.size() && LocationSlots[location] >= 0)
+			UniformCache[LocationSlots[location]].Valid = false;
+
+		return true;
 	}
 
 	int ShaderProgram::Internals::GetActiveUniformI(uint32_t index, GLenum pName) const
@@ -279,8 +592,10 @@ namespace Game
 	{
 		const size_t length = static_cast<size_t>(GetActiveUniformBlockI(index, GL_UNIFORM_BLOCK_NAME_LENGTH));
 		std::string name(length + 1, 0);
+		GLsizei written = 0;
 
-		glGetActiveUniformBlockName(Program, index, static_cast<GLsizei>(length), nullptr, &name[0]);
+		glGetActiveUniformBlockName(Program, index, static_cast<GLsizei>(length), &written, &name[0]);
+		name.resize(static_cast<size_t>(written));
 		return name;
 	}
 
@@ -317,8 +632,11 @@ namespace Game
 		GLenum type   = 0;
 
 		std::string name(length + 1, 0);
+		GLsizei written = 0;
+
+		glGetActiveUniform(Program, index, static_cast<GLsizei>(length), &written, &size, &type, &name[0]);
+		name.resize(static_cast<size_t>(written));
 
-		glGetActiveUniform(Program, index, static_cast<GLsizei>(length), nullptr, &size, &type, &name[0]);
 		UniformLocationType location = INVALID_UNIFORM_LOCATION;
 		location                     = glGetUniformLocation(Program, name.c_str());
 
@@ -364,6 +682,38 @@ namespace Game
 		return &program;
 	}
 
+	void ShaderProgram::Internals::SwapProgram(Internals &other)
+	{
+		std::swap(Program, other.Program);
+
+		std::swap(UniformsLocation, other.UniformsLocation);
+		std::swap(Attributes, other.Attributes);
+		std::swap(UniformBlocksIndex, other.UniformBlocksIndex);
+
+		std::swap(ActiveUniforms, other.ActiveUniforms);
+		std::swap(ActiveUniformBlocks, other.ActiveUniformBlocks);
+
+		std::swap(UniformSlots, other.UniformSlots);
+		std::swap(UniformBlockSlots, other.UniformBlockSlots);
+
+		std::swap(LocationSlots, other.LocationSlots);
+		std::swap(UniformCache, other.UniformCache);
+		std::swap(UniformValues, other.UniformValues);
+
+		std::swap(Linked, other.Linked);
+		std::swap(Pending, other.Pending);
+		std::swap(BinaryKey, other.BinaryKey);
+	}
+
+	bool ShaderProgram::Link()
+	{
+		if(!m_Internals->Link())
+			return false;
+
+		ShaderReloader::Register(*this);
+		return true;
+	}
+
 	const std::vector<ShaderProgram::UniformInfo>& ShaderProgram::GetActiveUniforms() const
 	{
 		return m_Internals->ActiveUniforms;
@@ -414,7 +764,10 @@ namespace Game
 		if(location == INVALID_UNIFORM_LOCATION)
 			return;
 
-		glUniform1i(location, value);
+		const int32_t values[] = {value};
+
+		if(m_Internals->UpdateUniformCache(location, values, sizeof(values)))
+			glProgramUniform1iv(m_Internals->Program, location, 1, values);
 	}
 
 	void ShaderProgram::UniformValue(UniformLocationType location, int32_t value, int32_t value2)
@@ -422,7 +775,10 @@ namespace Game
 		if(location == INVALID_UNIFORM_LOCATION)
 			return;
 
-		glUniform2i(location, value, value2);
+		const int32_t values[] = {value, value2};
+
+		if(m_Internals->UpdateUniformCache(location, values, sizeof(values)))
+			glProgramUniform2iv(m_Internals->Program, location, 1, values);
 	}
 
 	void ShaderProgram::UniformValue(UniformLocationType location, int32_t value, int32_t value2, int32_t value3)
@@ -430,7 +786,10 @@ namespace Game
 		if(location == INVALID_UNIFORM_LOCATION)
 			return;
 
-		glUniform3i(location, value, value2, value3);
+		const int32_t values[] = {value, value2, value3};
+
+		if(m_Internals->UpdateUniformCache(location, values, sizeof(values)))
+			glProgramUniform3iv(m_Internals->Program, location, 1, values);
 	}
 
 	void ShaderProgram::UniformValue(UniformLocationType location, uint32_t value)
@@ -438,14 +797,21 @@ namespace Game
 		if(location == INVALID_UNIFORM_LOCATION)
 			return;
 
-		glUniform1ui(location, value);
+		const uint32_t values[] = {value};
+
+		if(m_Internals->UpdateUniformCache(location, values, sizeof(values)))
+			glProgramUniform1uiv(m_Internals->Program, location, 1, values);
 	}
 
 	void ShaderProgram::UniformValue(UniformLocationType location, uint32_t value, uint32_t value2)
 	{
 		if(location == INVALID_UNIFORM_LOCATION)
 			return;
-		glUniform2ui(location, value, value2);
+
+		const uint32_t values[] = {value, value2};
+
+		if(m_Internals->UpdateUniformCache(location, values, sizeof(values)))
+			glProgramUniform2uiv(m_Internals->Program, location, 1, values);
 	}
 
 	void ShaderProgram::UniformValue(UniformLocationType location, uint32_t value, uint32_t value2, uint32_t value3)
@@ -453,7 +819,10 @@ namespace Game
 		if(location == INVALID_UNIFORM_LOCATION)
 			return;
 
-		glUniform3ui(location, value, value2, value3);
+		const uint32_t values[] = {value, value2, value3};
+
+		if(m_Internals->UpdateUniformCache(location, values, sizeof(values)))
+			glProgramUniform3uiv(m_Internals->Program, location, 1, values);
 	}
 
 	void ShaderProgram::UniformValue(UniformLocationType location, float value)
@@ -461,7 +830,10 @@ namespace Game
 		if(location == INVALID_UNIFORM_LOCATION)
 			return;
 
-		glUniform1f(location, value);
+		const float values[] = {value};
+
+		if(m_Internals->UpdateUniformCache(location, values, sizeof(values)))
+			glProgramUniform1fv(m_Internals->Program, location, 1, values);
 	}
 
 	void ShaderProgram::UniformValue(UniformLocationType location, float value1, float value2)
@@ -469,7 +841,10 @@ namespace Game
 		if(location == INVALID_UNIFORM_LOCATION)
 			return;
 
-		glUniform2f(location, value1, value2);
+		const float values[] = {value1, value2};
+
+		if(m_Internals->UpdateUniformCache(location, values, sizeof(values)))
+			glProgramUniform2fv(m_Internals->Program, location, 1, values);
 	}
 
 	void ShaderProgram::UniformValue(UniformLocationType location, float value1, float value2, float value3)
@@ -477,7 +852,10 @@ namespace Game
 		if(location == INVALID_UNIFORM_LOCATION)
 			return;
 
-		glUniform3f(location, value1, value2, value3);
+		const float values[] = {value1, value2, value3};
+
+		if(m_Internals->UpdateUniformCache(location, values, sizeof(values)))
+			glProgramUniform3fv(m_Internals->Program, location, 1, values);
 	}
 
 	void ShaderProgram::UniformValue(UniformLocationType location, const glm::vec2 &value)
@@ -485,7 +863,8 @@ namespace Game
 		if(location == INVALID_UNIFORM_LOCATION)
 			return;
 
-		glUniform2fv(location, 1, &value.x);
+		if(m_Internals->UpdateUniformCache(location, &value.x, sizeof(glm::vec2)))
+			glProgramUniform2fv(m_Internals->Program, location, 1, &value.x);
 	}
 
 	void ShaderProgram::UniformValue(UniformLocationType location, const glm::vec3 &value)
@@ -493,7 +872,8 @@ namespace Game
 		if(location == INVALID_UNIFORM_LOCATION)
 			return;
 
-		glUniform3fv(location, 1, &value.x);
+		if(m_Internals->UpdateUniformCache(location, &value.x, sizeof(glm::vec3)))
+			glProgramUniform3fv(m_Internals->Program, location, 1, &value.x);
 	}
 
 	void ShaderProgram::UniformValue(UniformLocationType location, const glm::vec4 &value)
@@ -501,7 +881,8 @@ namespace Game
 		if(location == INVALID_UNIFORM_LOCATION)
 			return;
 
-		glUniform4fv(location, 1, &value.x);
+		if(m_Internals->UpdateUniformCache(location, &value.x, sizeof(glm::vec4)))
+			glProgramUniform4fv(m_Internals->Program, location, 1, &value.x);
 	}
 
 	void ShaderProgram::UniformValue(UniformLocationType location, const glm::mat2x2 &value, bool transpose)
@@ -509,7 +890,10 @@ namespace Game
 		if(location == INVALID_UNIFORM_LOCATION)
 			return;
 
-		glUniformMatrix2fv(location, 1, transpose ? GL_TRUE : GL_FALSE, value_ptr(value));
+		if(!m_Internals->ShouldUploadMatrix(location, value_ptr(value), sizeof(glm::mat2x2), transpose))
+			return;
+
+		glProgramUniformMatrix2fv(m_Internals->Program, location, 1, transpose ? GL_TRUE : GL_FALSE, value_ptr(value));
 	}
 
 	void ShaderProgram::UniformValue(UniformLocationType location, const glm::mat2x3 &value, bool transpose)
@@ -517,7 +901,10 @@ namespace Game
 		if(location == INVALID_UNIFORM_LOCATION)
 			return;
 
-		glUniformMatrix2x3fv(location, 1, transpose ? GL_TRUE : GL_FALSE, value_ptr(value));
+		if(!m_Internals->ShouldUploadMatrix(location, value_ptr(value), sizeof(glm::mat2x3), transpose))
+			return;
+
+		glProgramUniformMatrix2x3fv(m_Internals->Program, location, 1, transpose ? GL_TRUE : GL_FALSE, value_ptr(value));
 	}
 
 	void ShaderProgram::UniformValue(UniformLocationType location, const glm::mat2x4 &value, bool transpose)
@@ -525,7 +912,10 @@ namespace Game
 		if(location == INVALID_UNIFORM_LOCATION)
 			return;
 
-		glUniformMatrix2x4fv(location, 1, transpose ? GL_TRUE : GL_FALSE, value_ptr(value));
+		if(!m_Internals->ShouldUploadMatrix(location, value_ptr(value), sizeof(glm::mat2x4), transpose))
+			return;
+
+		glProgramUniformMatrix2x4fv(m_Internals->Program, location, 1, transpose ? GL_TRUE : GL_FALSE, value_ptr(value));
 	}
 
 	void ShaderProgram::UniformValue(UniformLocationType location, const glm::mat3x2 &value, bool transpose)
@@ -533,7 +923,10 @@ namespace Game
 		if(location == INVALID_UNIFORM_LOCATION)
 			return;
 
-		glUniformMatrix3x2fv(location, 1, transpose ? GL_TRUE : GL_FALSE, value_ptr(value));
+		if(!m_Internals->ShouldUploadMatrix(location, value_ptr(value), sizeof(glm::mat3x2), transpose))
+			return;
+
+		glProgramUniformMatrix3x2fv(m_Internals->Program, location, 1, transpose ? GL_TRUE : GL_FALSE, value_ptr(value));
 	}
 
 	void ShaderProgram::UniformValue(UniformLocationType location, const glm::mat3x3 &value, bool transpose)
@@ -541,7 +934,10 @@ namespace Game
 		if(location == INVALID_UNIFORM_LOCATION)
 			return;
 
-		glUniformMatrix3fv(location, 1, transpose ? GL_TRUE : GL_FALSE, value_ptr(value));
+		if(!m_Internals->ShouldUploadMatrix(location, value_ptr(value), sizeof(glm::mat3x3), transpose))
+			return;
+
+		glProgramUniformMatrix3fv(m_Internals->Program, location, 1, transpose ? GL_TRUE : GL_FALSE, value_ptr(value));
 	}
 
 	void ShaderProgram::UniformValue(UniformLocationType location, const glm::mat3x4 &value, bool transpose)
@@ -549,7 +945,10 @@ namespace Game
 		if(location == INVALID_UNIFORM_LOCATION)
 			return;
 
-		glUniformMatrix3x4fv(location, 1, transpose ? GL_TRUE : GL_FALSE, value_ptr(value));
+		if(!m_Internals->ShouldUploadMatrix(location, value_ptr(value), sizeof(glm::mat3x4), transpose))
+			return;
+
+		glProgramUniformMatrix3x4fv(m_Internals->Program, location, 1, transpose ? GL_TRUE : GL_FALSE, value_ptr(value));
 	}
 
 	void ShaderProgram::UniformValue(UniformLocationType location, const glm::mat4x2 &value, bool transpose)
@@ -557,7 +956,10 @@ namespace Game
 		if(location == INVALID_UNIFORM_LOCATION)
 			return;
 
-		glUniformMatrix4x2fv(location, 1, transpose ? GL_TRUE : GL_FALSE, value_ptr(value));
+		if(!m_Internals->ShouldUploadMatrix(location, value_ptr(value), sizeof(glm::mat4x2), transpose))
+			return;
+
+		glProgramUniformMatrix4x2fv(m_Internals->Program, location, 1, transpose ? GL_TRUE : GL_FALSE, value_ptr(value));
 	}
 
 	void ShaderProgram::UniformValue(UniformLocationType location, const glm::mat4x3 &value, bool transpose)
@@ -565,7 +967,10 @@ namespace Game
 		if(location == INVALID_UNIFORM_LOCATION)
 			return;
 
-		glUniformMatrix4x3fv(location, 1, transpose ? GL_TRUE : GL_FALSE, value_ptr(value));
+		if(!m_Internals->ShouldUploadMatrix(location, value_ptr(value), sizeof(glm::mat4x3), transpose))
+			return;
+
+		glProgramUniformMatrix4x3fv(m_Internals->Program, location, 1, transpose ? GL_TRUE : GL_FALSE, value_ptr(value));
 	}
 
 	void ShaderProgram::UniformValue(UniformLocationType location, const glm::mat4x4 &value, bool transpose)
@@ -573,7 +978,10 @@ namespace Game
 		if(location == INVALID_UNIFORM_LOCATION)
 			return;
 
-		glUniformMatrix4fv(location, 1, transpose ? GL_TRUE : GL_FALSE, value_ptr(value));
+		if(!m_Internals->ShouldUploadMatrix(location, value_ptr(value), sizeof(glm::mat4x4), transpose))
+			return;
+
+		glProgramUniformMatrix4fv(m_Internals->Program, location, 1, transpose ? GL_TRUE : GL_FALSE, value_ptr(value));
 	}
 
 	void ShaderProgram::UniformValue(UniformLocationType location, const Texture &texture, int32_t sampleUnit)
@@ -582,10 +990,19 @@ namespace Game
 			return;
 
 		glActiveTexture(GL_TEXTURE0 + sampleUnit);
-		glUniform1i(location, sampleUnit);
+
+		if(m_Internals->UpdateUniformCache(location, &sampleUnit, sizeof(sampleUnit)))
+			glProgramUniform1i(m_Internals->Program, location, sampleUnit);
+
 		texture.Bind();
 	}
 
+	void ShaderProgram::ResetUploadStatistics()
+	{
+		s_IssuedUploads = 0;
+		s_ElidedUploads = 0;
+	}
+
 	void ShaderProgram::BindUniformBuffer(UniformBlockIndexType index, const UniformBuffer &buffer)
 	{
 		if(index == INVALID_UNIFORM_BLOCK_INDEX)
@@ -3,6 +3,7 @@
 #include "Engine/Core/Base.h"
 #include "Engine/OpenGL/GLEnums.h"
 #include "Engine/OpenGL/Shader.h"
+#include "Engine/Utils/Hash.h"
 
 #include <memory>
 #include <unordered_map>
@@ -35,6 +36,9 @@ namespace Game
 
 	class ShaderProgram
 	{
+		friend class ShaderCompiler;
+		friend class ShaderReloader;
+
 	public:
 		using IDType = uint32_t;
 		using UniformLocationType = int32_t;
@@ -54,6 +58,13 @@ namespace Game
 			UniformLocationType Location = INVALID_UNIFORM_LOCATION;
 		};
 
+		struct UniformCacheEntry
+		{
+			size_t Offset = 0;
+			size_t Size   = 0;
+			bool Valid    = false;
+		};
+
 		struct UniformBlockInfo
 		{
 			std::string Name;
@@ -89,7 +100,9 @@ namespace Game
 
 			GeometryVerticesOut = GL_GEOMETRY_VERTICES_OUT,
 			GeometryInputType = GL_GEOMETRY_INPUT_TYPE,
-			GeometryOutputType = GL_GEOMETRY_OUTPUT_TYPE
+			GeometryOutputType = GL_GEOMETRY_OUTPUT_TYPE,
+
+			CompletionStatus = GL_COMPLETION_STATUS_KHR
 		};
 
 		class Internals
@@ -104,10 +117,20 @@ namespace Game
 			std::vector<UniformInfo> ActiveUniforms;
 			std::vector<UniformBlockInfo> ActiveUniformBlocks;
 
+			std::unordered_map<uint64_t, uint32_t, IdentityHash> UniformSlots;
+			std::unordered_map<uint64_t, uint32_t, IdentityHash> UniformBlockSlots;
+
+			std::vector<int32_t> LocationSlots;
+			std::vector<UniformCacheEntry> UniformCache;
+			std::vector<uint8_t> UniformValues;
+
 			std::unordered_set<Ref<Shader>> Shaders;
 
 			bool Linked  = false;
 			bool Changed = false;
+			bool Pending = false;
+
+			uint64_t BinaryKey = 0;
 
 			std::string Name;
 
@@ -125,6 +148,16 @@ namespace Game
 			bool Link();
 			void Use() const;
 
+			bool SubmitLink();
+			bool LoadCachedBinary();
+			bool SubmitSourceLink();
+			bool IsLinkReady() const;
+			bool FinishLink();
+
+			uint64_t GetBinaryKey() const;
+			bool LoadBinary(uint64_t key);
+			void SaveBinary(uint64_t key) const;
+
 			std::string GetLog() const;
 
 			bool HasUniform(const std::string &name) const;
@@ -133,6 +166,9 @@ namespace Game
 			UniformLocationType GetUniformLocation(const std::string &name) const;
 			UniformBlockIndexType GetUniformBlockIndex(const std::string &name) const;
 
+			UniformLocationType GetUniformLocation(HashedString name) const;
+			UniformBlockIndexType GetUniformBlockIndex(HashedString name) const;
+
 			const std::vector<UniformInfo>& GetActiveUniforms() const { return ActiveUniforms; }
 
 			int Get(ParametersName name) const;
@@ -141,6 +177,10 @@ namespace Game
 			void Populate();
 			void PopulateUniformBlocks();
 			void PopulateUniforms();
+			void PopulateUniformCache();
+
+			bool UpdateUniformCache(UniformLocationType location, const void *data, size_t size);
+			bool ShouldUploadMatrix(UniformLocationType location, const void *data, size_t size, bool transpose);
 
 			int GetActiveUniformI(uint32_t index, GLenum pName) const;
 			int GetActiveUniformBlockI(uint32_t index, GLenum pName) const;
@@ -149,11 +189,22 @@ namespace Game
 
 			UniformBlockInfo QueryUniformBlock(uint32_t index) const;
 			UniformInfo QueryUniform(uint32_t index) const;
+
+			void SwapProgram(Internals &other);
 		};
 
 		Pointer<Internals> m_Internals = nullptr;
 
+		static inline uint64_t s_IssuedUploads = 0;
+		static inline uint64_t s_ElidedUploads = 0;
+
 	public:
+		struct UploadStatistics
+		{
+			uint64_t Issued = 0;
+			uint64_t Elided = 0;
+		};
+
 		explicit ShaderProgram(const std::string &name = PROGRAM_SHADER_NAME);
 		ShaderProgram(IDType id, const std::string &name = PROGRAM_SHADER_NAME);
 		ShaderProgram(const std::string &name, Ref<Shader> shader);
@@ -173,7 +224,12 @@ namespace Game
 
 		Ref<Shader> GetShader(Shader::Type type) const;
 
-		bool Link() { return m_Internals->Link(); }
+		bool Link();
+
+		bool SubmitLink() { return m_Internals->SubmitLink(); }
+		bool IsLinkPending() const { return m_Internals->Pending; }
+		bool IsLinkReady() const { return m_Internals->IsLinkReady(); }
+		bool FinishLink() { return m_Internals->FinishLink(); }
 
 		void Use() const { m_Internals->Use(); }
 
@@ -196,10 +252,24 @@ namespace Game
 			return m_Internals->GetUniformBlockIndex(name);
 		}
 
+		UniformLocationType GetUniformLocation(HashedString name) const
+		{
+			return m_Internals->GetUniformLocation(name);
+		}
+
+		UniformBlockIndexType GetUniformBlockIndex(HashedString name) const
+		{
+			return m_Internals->GetUniformBlockIndex(name);
+		}
+
 		bool HasUniform(const std::string &name) const { return m_Internals->HasUniform(name); }
+		bool HasUniform(HashedString name) const { return GetUniformLocation(name) != INVALID_UNIFORM_LOCATION; }
 
 		static ShaderProgram* GetDefault();
 
+		static UploadStatistics GetUploadStatistics() { return {s_IssuedUploads, s_ElidedUploads}; }
+		static void ResetUploadStatistics();
+
 		std::unordered_set<Ref<Shader>>::iterator begin() { return m_Internals->Shaders.begin(); }
 		std::unordered_set<Ref<Shader>>::iterator end() { return m_Internals->Shaders.end(); }
 
@@ -243,6 +313,22 @@ namespace Game
 			Detach(std::forward<Args>(args)...);
 		}
 
+		template <class ...Args>
+		void UniformValue(HashedString name, Args &&... args)
+		{
+			return UniformValue(GetUniformLocation(name), std::forward<Args>(args)...);
+		}
+
+		void BindUniformBuffer(HashedString name, const UniformBuffer &buffer)
+		{
+			return BindUniformBuffer(GetUniformBlockIndex(name), buffer);
+		}
+
+		void BindUniformBuffer(HashedString name, const UniformBuffer &buffer, size_t size, size_t offset)
+		{
+			return BindUniformBuffer(GetUniformBlockIndex(name), buffer, size, offset);
+		}
+
 		void UniformValue(const std::string &name, bool value)
 		{
 			return UniformValue(GetUniformLocation(name), static_cast<int32_t>(value));
@@ -300,7 +386,7 @@ namespace Game
 
 		void UniformValue(const std::string &name, float value, float value2, float value3)
 		{
-			return UniformValue(GetUniformLocation(name), value, value3);
+			return UniformValue(GetUniformLocation(name), value, value2, value3);
 		}
 
 		void UniformValue(const std::string &name, const glm::vec2 &value)
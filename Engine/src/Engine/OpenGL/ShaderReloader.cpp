@@ -0,0 +1,167 @@
+#include "pch.h"
+#include "Engine/OpenGL/ShaderReloader.h"
+
+#include "Engine/OpenGL/ShaderCache.h"
+#include "Engine/OpenGL/ShaderPreprocessor.h"
+
+namespace Game
+{
+	void ShaderReloader::Register(const ShaderProgram &program)
+	{
+		if(!s_Enabled)
+			return;
+
+		const auto internals = program.m_Internals;
+
+		const bool registered = std::ranges::any_of(
+		                                            s_Programs,
+		                                            [&internals](const std::weak_ptr<ProgramInternals> &tracked)
+		                                            {
+			                                            return !tracked.owner_before(internals) && !internals.owner_before(tracked);
+		                                            }
+		                                           );
+
+		if(!s_Watcher)
+			s_Watcher = MakeScope<FileWatcher>();
+
+		for(const auto &shader : internals->Shaders)
+			Watch(shader->GetSource());
+
+		if(!registered)
+			s_Programs.emplace_back(internals);
+	}
+
+	void ShaderReloader::Update()
+	{
+		if(!s_Watcher || !s_Watcher->HasChanges())
+			return;
+
+		const auto changes = s_Watcher->PollChanges();
+
+		for(const auto &change : changes)
+		{
+			GL_LOG_INFO("Shader file \"{}\" changed", change.string());
+			ShaderPreprocessor::Invalidate(change);
+			ShaderCache::Invalidate(change);
+		}
+
+		std::erase_if(s_Programs, [](const std::weak_ptr<ProgramInternals> &program) { return program.expired(); });
+
+		std::vector<Pointer<ProgramInternals>> programs;
+		programs.reserve(s_Programs.size());
+
+		for(const auto &tracked : s_Programs)
+		{
+			if(auto program = tracked.lock())
+				programs.emplace_back(std::move(program));
+		}
+
+		// ShaderCache hands the same Shader to every program using a permutation, each one is recompiled once
+		Replacements replaced;
+
+		for(const auto &program : programs)
+		{
+			for(const auto &shader : program->Shaders)
+			{
+				const auto &source = shader->GetSource();
+
+				if(std::ranges::any_of(replaced, [&shader](const auto &pair) { return pair.first == shader; }))
+					continue;
+
+				if(!std::ranges::any_of(changes, [&source](const std::filesystem::path &change) { return source.DependsOn(change); }))
+					continue;
+
+				auto reloaded = MakeRef<Shader>(shader->GetType(), ShaderPreprocessor::Load(source.Path(), source.Defines()), false);
+				reloaded->SubmitCompile();
+
+				replaced.emplace_back(shader, std::move(reloaded));
+			}
+		}
+
+		if(replaced.empty())
+			return;
+
+		std::vector<Ref<Shader>> failed;
+
+		for(const auto &[shader, reloaded] : replaced)
+		{
+			if(!reloaded->FinishCompile())
+			{
+				GL_LOG_ERROR("Reload of {} shader failed, keeping previous one:\n{}", reloaded->TypeToString(), reloaded->GetLog());
+				failed.emplace_back(shader);
+			}
+		}
+
+		std::erase_if(replaced, [&failed](const auto &pair) { return std::ranges::find(failed, pair.first) != failed.end(); });
+
+		for(const auto &program : programs)
+		{
+			const bool usesFailed = std::ranges::any_of(program->Shaders, [&failed](const Ref<Shader> &shader) { return std::ranges::find(failed, shader) != failed.end(); });
+
+			if(usesFailed)
+				GL_LOG_ERROR("Keeping previous {} shader program (id: {}), one of its shaders failed to compile", program->Name, program->Program);
+			else
+				Relink(*program, replaced);
+		}
+
+		// Swap contents so every ShaderProgram and Shader handle sharing these internals picks up the new objects
+		for(const auto &[shader, reloaded] : replaced)
+		{
+			shader->m_Internals->Swap(*reloaded->m_Internals);
+			Watch(shader->GetSource());
+		}
+	}
+
+	void ShaderReloader::Shutdown()
+	{
+		s_Watcher = nullptr;
+		s_Programs.clear();
+	}
+
+	void ShaderReloader::Watch(const ShaderSource &source)
+	{
+		if(source.Path().empty())
+			return;
+
+		s_Watcher->Watch(source.Path());
+
+		for(const auto &dependency : source.Dependencies())
+			s_Watcher->Watch(dependency);
+	}
+
+	bool ShaderReloader::Relink(ProgramInternals &program, const Replacements &replaced)
+	{
+		const bool affected = std::ranges::any_of(
+		                                          program.Shaders,
+		                                          [&replaced](const Ref<Shader> &shader)
+		                                          {
+			                                          return std::ranges::any_of(replaced, [&shader](const auto &pair) { return pair.first == shader; });
+		                                          }
+		                                         );
+
+		if(!affected)
+			return false;
+
+		GL_LOG_INFO("Reloading {} (id: {}) shader program", program.Name, program.Program);
+
+		ProgramInternals candidate(program.Name);
+
+		for(const auto &shader : program.Shaders)
+		{
+			const auto it = std::ranges::find_if(replaced, [&shader](const auto &pair) { return pair.first == shader; });
+			candidate.Attach(it == replaced.end() ? shader : it->second);
+		}
+
+		if(!candidate.Link())
+		{
+			GL_LOG_ERROR("Reload of {} shader program failed, keeping previous program:\n{}", program.Name, candidate.GetLog());
+			return false;
+		}
+
+		program.SwapProgram(candidate);
+		candidate.Shaders.clear();
+
+		GL_LOG_INFO("Reloaded {} shader program (id: {})", program.Name, program.Program);
+		return true;
+	}
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/OpenGL/ShaderProgram.h"
+#include "Engine/Utils/FileWatcher.h"
+
+#include <filesystem>
+#include <vector>
+
+namespace Game
+{
+	class ShaderReloader
+	{
+		using ProgramInternals = ShaderProgram::Internals;
+		using Replacements     = std::vector<std::pair<Ref<Shader>, Ref<Shader>>>;
+
+		static inline std::vector<std::weak_ptr<ProgramInternals>> s_Programs;
+		static inline Scope<FileWatcher> s_Watcher;
+
+#ifdef GAME_DIST
+		static inline bool s_Enabled = false;
+#else
+		static inline bool s_Enabled = true;
+#endif
+
+	public:
+		static void Enable(bool enabled) { s_Enabled = enabled; }
+		static bool IsEnabled() { return s_Enabled; }
+
+		static void Register(const ShaderProgram &program);
+		static void Update();
+
+		static void Shutdown();
+
+	private:
+		static void Watch(const ShaderSource &source);
+		static bool Relink(ProgramInternals &program, const Replacements &replaced);
+	};
+}
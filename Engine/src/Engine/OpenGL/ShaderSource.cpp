@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "Engine/OpenGL/ShaderSource.h"
+#include "Engine/OpenGL/ShaderPreprocessor.h"
 
 namespace Game
 {
@@ -19,7 +20,15 @@ namespace Game
 		std::stringstream stream;
 		stream << file.rdbuf();
 
-		return ShaderSource(stream.str());
+		ShaderSource source(stream.str());
+		source.m_Path = path;
+
+		return source;
+	}
+
+	ShaderSource ShaderSource::Load(const std::filesystem::path path, const ShaderDefines &defines)
+	{
+		return ShaderPreprocessor::Load(path, defines);
 	}
 
 	ShaderSource::ShaderSource(const std::string &source) : m_Source(source) {}
@@ -28,4 +37,28 @@ namespace Game
 	{
 		m_Source = source;
 	}
+
+	bool ShaderSource::DependsOn(const std::filesystem::path &path) const
+	{
+		if(m_Path.empty())
+			return false;
+
+		std::error_code error;
+		if(std::filesystem::equivalent(m_Path, path, error))
+			return true;
+
+		return std::ranges::any_of(
+		                           m_Dependencies,
+		                           [&path](const std::filesystem::path &dependency)
+		                           {
+			                           std::error_code error;
+			                           return std::filesystem::equivalent(dependency, path, error);
+		                           }
+		                          );
+	}
+
+	ShaderSource ShaderSource::Preprocess(const ShaderDefines &defines) const
+	{
+		return ShaderPreprocessor::Process(*this, defines);
+	}
 }
@@ -1,19 +1,41 @@
 #pragma once
 #include "Engine/Core/Base.h"
 
+#include <map>
+
 namespace Game
 {
+	using ShaderDefines = std::map<std::string, std::string>;
+
 	class ShaderSource
 	{
 		std::string m_Source;
+		std::filesystem::path m_Path;
+
+		std::vector<std::filesystem::path> m_Dependencies;
+		ShaderDefines m_Defines;
 
 	public:
 		ShaderSource() = default;
 		ShaderSource(const std::string &source);
 
 		static ShaderSource Load(const std::filesystem::path path);
+		static ShaderSource Load(const std::filesystem::path path, const ShaderDefines &defines);
 
 		const std::string& Source() const { return m_Source; }
 		void Source(const std::string& source);
+
+		const std::filesystem::path& Path() const { return m_Path; }
+		void Path(const std::filesystem::path &path) { m_Path = path; }
+
+		const std::vector<std::filesystem::path>& Dependencies() const { return m_Dependencies; }
+		void Dependencies(std::vector<std::filesystem::path> dependencies) { m_Dependencies = std::move(dependencies); }
+
+		const ShaderDefines& Defines() const { return m_Defines; }
+		void Defines(const ShaderDefines &defines) { m_Defines = defines; }
+
+		bool DependsOn(const std::filesystem::path &path) const;
+
+		ShaderSource Preprocess(const ShaderDefines &defines = {}) const;
 	};
 }
@@ -3,6 +3,8 @@
 
 #include "Engine/OpenGL/CubeMap.h"
 #include "Engine/Core/Image.h"
+#include "Engine/Core/CompressedImage.h"
+#include "Engine/Core/MipChain.h"
 #include "Engine/Renderer/Context.h"
 
 
@@ -23,6 +25,16 @@ namespace Game
 		Create(image, levels);
 	}
 
+	Texture::Texture(const CompressedImage &image) : Texture()
+	{
+		Create(image);
+	}
+
+	Texture::Texture(const MipChain &chain) : Texture()
+	{
+		Create(chain);
+	}
+
 	void Texture::Create(uint32_t width, uint32_t height, uint32_t levels)
 	{
 		Create(Vector2u{width, height}, levels);
@@ -41,6 +53,18 @@ namespace Game
 		TextureObject::Create(image, static_cast<int32_t>(levels) < 0 ? CalculateLevels(image.Size()) : levels);
 	}
 
+	void Texture::Create(const CompressedImage &image)
+	{
+		ASSERT(image.Width() < GetMaxSize() && image.Height() < GetMaxSize());
+		TextureObject::Create(image);
+	}
+
+	void Texture::Create(const MipChain &chain)
+	{
+		ASSERT(chain.Size().Width < GetMaxSize() && chain.Size().Height < GetMaxSize());
+		TextureObject::Create(chain);
+	}
+
 	void Texture::Resize(uint32_t width, uint32_t height)
 	{
 		Create(Vector2u{width, height}, Levels());
@@ -110,6 +134,16 @@ namespace Game
 		TextureObject::Update(image, 0, offset);
 	}
 
+	void Texture::Update(const CompressedImage &image)
+	{
+		TextureObject::Update(image);
+	}
+
+	void Texture::Update(const MipChain &chain)
+	{
+		TextureObject::Update(chain);
+	}
+
 	uint64_t Texture::GetMaxSize()
 	{
 		static bool s_Checked = false;
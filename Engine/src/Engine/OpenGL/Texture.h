@@ -23,10 +23,14 @@ namespace Game
 		Texture(const Vector2u &size, uint32_t levels = -1);
 		Texture(uint32_t width, uint32_t height, uint32_t levels = -1);
 		explicit Texture(const Image &image, uint32_t levels = -1);
+		explicit Texture(const CompressedImage &image);
+		explicit Texture(const MipChain &chain);
 
 		void Create(uint32_t width, uint32_t height, uint32_t levels = -1);
 		void Create(const Vector2u &size, uint32_t levels = -1);
 		void Create(const Image &image, uint32_t levels = -1);
+		void Create(const CompressedImage &image);
+		void Create(const MipChain &chain);
 
 		void Resize(uint32_t width, uint32_t height);
 		void Resize(const Vector2u &size);
@@ -47,6 +51,9 @@ namespace Game
 		void Update(const Image &image, int32_t x, int32_t y);
 		void Update(const Image &image, const Vector2i &offset);
 
+		void Update(const CompressedImage &image);
+		void Update(const MipChain &chain);
+
 		static uint64_t GetMaxSize();
 		static float GetMaxLod();
 	};
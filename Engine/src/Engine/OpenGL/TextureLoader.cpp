@@ -0,0 +1,302 @@
+#include "pch.h"
+#include "Engine/OpenGL/TextureLoader.h"
+
+#include "Engine/Core/ThreadPool.h"
+#include "Engine/Renderer/Context.h"
+
+#include <filesystem>
+
+namespace Game
+{
+	static std::string NormalizePath(const std::string &path)
+	{
+		return std::filesystem::path(path).lexically_normal().generic_string();
+	}
+
+	static bool IsCompressedContainer(const std::string &path)
+	{
+		auto extension = std::filesystem::path(path).extension().string();
+		std::ranges::transform(extension, extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+		return extension == ".dds" || extension == ".ktx2";
+	}
+
+	void TextureLoader::SetStagingBuffers(uint32_t count, size_t size)
+	{
+		ASSERT(count > 0 && size > 0, "Invalid staging buffer configuration");
+		if(count == 0 || size == 0)
+			throw std::invalid_argument("Invalid staging buffer configuration");
+
+		ReleaseSlots();
+
+		s_SlotCount = count;
+		s_SlotSize  = size;
+	}
+
+	Ref<Texture> TextureLoader::Load(const std::string &path, Callback callback)
+	{
+		const auto key = NormalizePath(path);
+
+		if(const auto it = s_Textures.find(key); it != s_Textures.end())
+		{
+			const auto &texture = it->second;
+
+			if(callback)
+			{
+				if(const auto request = s_Requests.find(texture.get()); request != s_Requests.end())
+				{
+					auto &onComplete = request->second->OnComplete;
+					onComplete = [previous = std::move(onComplete), callback = std::move(callback)](const Ref<Texture> &texture, bool success)
+					{
+						if(previous)
+							previous(texture, success);
+						callback(texture, success);
+					};
+				}
+				else
+					callback(texture, true);
+			}
+
+			return texture;
+		}
+
+		auto request        = MakePointer<Request>();
+		request->Path       = key;
+		request->Target     = CreatePlaceholder();
+		request->OnComplete = std::move(callback);
+
+		s_Textures[key]                   = request->Target;
+		s_Requests[request->Target.get()] = request;
+
+		GL_LOG_DEBUG("Streaming texture: {}", key);
+
+		if(s_Pool)
+			s_Pool->Submit([request]() { Decode(request); });
+		else
+			Decode(request);
+
+		return request->Target;
+	}
+
+	bool TextureLoader::IsReady(const Ref<Texture> &texture)
+	{
+		return texture && !s_Requests.contains(texture.get());
+	}
+
+	void TextureLoader::Update()
+	{
+		{
+			std::scoped_lock lock(s_Mutex);
+
+			while(!s_Decoded.empty())
+			{
+				s_Uploads.emplace_back(std::move(s_Decoded.front()));
+				s_Decoded.pop_front();
+			}
+		}
+
+		size_t budget = s_Budget;
+
+		while(!s_Uploads.empty())
+		{
+			const auto request = s_Uploads.front();
+
+			if(!request->Failed && !Upload(*request, budget))
+				return;
+
+			s_Uploads.pop_front();
+			Complete(request, !request->Failed);
+
+			if(budget == 0)
+				return;
+		}
+	}
+
+	void TextureLoader::ClearCashed()
+	{
+		s_Textures.clear();
+	}
+
+	void TextureLoader::Shutdown()
+	{
+		if(s_Pool)
+			s_Pool->Wait();
+
+		{
+			std::scoped_lock lock(s_Mutex);
+			s_Decoded.clear();
+		}
+
+		s_Uploads.clear();
+		s_Requests.clear();
+		s_Textures.clear();
+
+		ReleaseSlots();
+	}
+
+	Ref<Texture> TextureLoader::CreatePlaceholder()
+	{
+		const Color pixels[] = {
+			Color::Magenta, Color::Black,
+			Color::Black, Color::Magenta
+		};
+
+		auto texture = MakeRef<Texture>(2, 2, 1);
+		texture->Update(pixels);
+
+		return texture;
+	}
+
+	void TextureLoader::Decode(const Pointer<Request> &request)
+	{
+		try
+		{
+			if(IsCompressedContainer(request->Path))
+				request->Compressed.Load(request->Path);
+			else
+				request->Pixels.Load(request->Path);
+		}
+		catch(std::exception &ex)
+		{
+			GL_LOG_ERROR("Unable to load texture \"{}\": {}", request->Path, ex.what());
+			request->Failed = true;
+		}
+
+		std::scoped_lock lock(s_Mutex);
+		s_Decoded.emplace_back(request);
+	}
+
+	bool TextureLoader::Upload(Request &request, size_t &budget)
+	{
+		if(!request.Compressed.Empty())
+		{
+			const size_t size = request.Compressed.DataSize();
+			if(size > budget && budget != s_Budget)
+				return false;
+
+			if(!Texture::IsFormatSupported(request.Compressed.Format()))
+			{
+				GL_LOG_ERROR("Compressed format of \"{}\" is not supported", request.Path);
+				request.Failed = true;
+				return true;
+			}
+
+			request.Staging = MakeRef<Texture>(request.Compressed);
+			budget -= std::min(size, budget);
+
+			return true;
+		}
+
+		auto functions = Context::GetContext()->GetFunctions();
+
+		const auto &pixels = request.Pixels;
+
+		if(!request.Staging)
+		{
+			request.Staging = MakeRef<Texture>();
+			request.Staging->Create(pixels.Size());
+		}
+
+		if(s_Slots.empty())
+		{
+			s_Slots.resize(s_SlotCount);
+			for(auto &slot : s_Slots)
+				slot.Buffer = MakeScope<PixelBuffer>(s_SlotSize);
+		}
+
+		const size_t rowSize    = static_cast<size_t>(pixels.Width()) * sizeof(Color);
+		const uint32_t slotRows = static_cast<uint32_t>(std::max<size_t>(1, s_SlotSize / rowSize));
+
+		while(request.Row < pixels.Height())
+		{
+			const uint32_t rows = std::min(pixels.Height() - request.Row, slotRows);
+			const size_t size   = rows * rowSize;
+
+			if(size > budget && budget != s_Budget)
+				return false;
+
+			auto &slot = s_Slots[s_NextSlot];
+			if(!AcquireSlot(slot))
+				return false;
+
+			if(slot.Buffer->Size() < size)
+				slot.Buffer->Realloc(size);
+
+			void *data = slot.Buffer->Map(BufferAccess::WriteOnly);
+			if(!data)
+			{
+				GL_LOG_ERROR("Unable to map pixel buffer for \"{}\"", request.Path);
+				request.Failed = true;
+				return true;
+			}
+
+			std::memcpy(data, pixels.GetPixels() + static_cast<size_t>(request.Row) * pixels.Width(), size);
+			slot.Buffer->UnMap();
+
+			slot.Buffer->Bind();
+			functions.SubImage2D(
+			                     request.Staging->ID(),
+			                     0,
+			                     0,
+			                     static_cast<int32_t>(request.Row),
+			                     pixels.Width(),
+			                     rows,
+			                     Format::Rgba,
+			                     DataType::UnsignedByte,
+			                     nullptr
+			                    );
+			slot.Buffer->UnBind();
+
+			slot.InFlight = Fence(false);
+			s_NextSlot = (s_NextSlot + 1) % static_cast<uint32_t>(s_Slots.size());
+
+			request.Row += rows;
+			budget -= std::min(size, budget);
+		}
+
+		return true;
+	}
+
+	void TextureLoader::Complete(const Pointer<Request> &request, bool success)
+	{
+		auto &target = request->Target;
+
+		if(success)
+		{
+			auto &staging = request->Staging;
+
+			if(request->Compressed.Empty())
+				staging->GenerateMipMaps();
+			staging->SetFilter(target->GetFilter());
+			staging->SetWrapping(target->GetWrapping());
+
+			std::swap(target->m_Internals, staging->m_Internals);
+
+			GL_LOG_DEBUG("Texture streamed: {} ({}x{})", request->Path, target->Width(), target->Height());
+		}
+
+		request->Pixels.Clear();
+		request->Compressed.Clear();
+		request->Staging = nullptr;
+
+		s_Requests.erase(target.get());
+
+		if(request->OnComplete)
+			request->OnComplete(target, success);
+	}
+
+	bool TextureLoader::AcquireSlot(Slot &slot)
+	{
+		if(!slot.InFlight.IsSignaled())
+			return false;
+
+		slot.InFlight.Reset();
+		return true;
+	}
+
+	void TextureLoader::ReleaseSlots()
+	{
+		s_Slots.clear();
+		s_NextSlot = 0;
+	}
+}
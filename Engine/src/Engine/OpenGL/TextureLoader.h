@@ -0,0 +1,92 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/Core/Image.h"
+#include "Engine/Core/CompressedImage.h"
+#include "Engine/OpenGL/Fence.h"
+#include "Engine/OpenGL/PixelBuffer.h"
+#include "Engine/OpenGL/Texture.h"
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Game
+{
+	class ThreadPool;
+
+	class TextureLoader
+	{
+	public:
+		using Callback = std::function<void(const Ref<Texture>&, bool)>;
+
+	private:
+		struct Request
+		{
+			std::string Path;
+
+			Ref<Texture> Target;
+			Ref<Texture> Staging;
+
+			Image Pixels;
+			CompressedImage Compressed;
+			uint32_t Row = 0;
+			bool Failed  = false;
+
+			Callback OnComplete;
+		};
+
+		struct Slot
+		{
+			Scope<PixelBuffer> Buffer;
+			Fence InFlight;
+		};
+
+		static inline std::unordered_map<std::string, Ref<Texture>> s_Textures;
+		static inline std::unordered_map<const Texture*, Pointer<Request>> s_Requests;
+
+		static inline std::mutex s_Mutex;
+		static inline std::deque<Pointer<Request>> s_Decoded;
+		static inline std::deque<Pointer<Request>> s_Uploads;
+
+		static inline std::vector<Slot> s_Slots;
+		static inline uint32_t s_NextSlot = 0;
+
+		static inline uint32_t s_SlotCount = 3;
+		static inline size_t s_SlotSize    = 4 * 1024 * 1024;
+		static inline size_t s_Budget      = 8 * 1024 * 1024;
+
+		static inline ThreadPool *s_Pool = nullptr;
+
+	public:
+		static void SetThreadPool(ThreadPool *pool) { s_Pool = pool; }
+
+		static void SetUploadBudget(size_t bytes) { s_Budget = bytes; }
+		static size_t GetUploadBudget() { return s_Budget; }
+
+		static void SetStagingBuffers(uint32_t count, size_t size);
+
+		static Ref<Texture> Load(const std::string &path, Callback callback = nullptr);
+
+		static bool IsReady(const Ref<Texture> &texture);
+		static size_t GetPendingCount() { return s_Requests.size(); }
+
+		static void Update();
+
+		static void ClearCashed();
+		static void Shutdown();
+
+	private:
+		static Ref<Texture> CreatePlaceholder();
+
+		static void Decode(const Pointer<Request> &request);
+		static bool Upload(Request &request, size_t &budget);
+		static void Complete(const Pointer<Request> &request, bool success);
+
+		static bool AcquireSlot(Slot &slot);
+		static void ReleaseSlots();
+	};
+}
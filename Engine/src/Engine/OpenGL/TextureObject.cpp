@@ -2,6 +2,8 @@
 #include "Engine/OpenGL/TextureObject.h"
 
 #include "Engine/Core/Image.h"
+#include "Engine/Core/CompressedImage.h"
+#include "Engine/Core/MipChain.h"
 
 #include "Engine/Renderer/Context.h"
 
@@ -50,15 +52,34 @@ namespace Game
 		const Vector2i &offset
 		)
 	{
-		ASSERT(size.Width + offset.X < Size.Width && size.Height + offset.Y < Size.Height);
+		ASSERT(size.Width + offset.X <= Size.Width && size.Height + offset.Y <= Size.Height);
 
-		if(size.Width + offset.X >= Size.Width || size.Height + offset.Y >= Size.Height)
+		if(size.Width + offset.X > Size.Width || size.Height + offset.Y > Size.Height)
 			throw std::out_of_range("Out of range");
 
 		if(pixels)
 			Functions.SubImage2D(Texture, level, offset, size, format, type, pixels);
 	}
 
+	void TextureObject::Internals::UpdateCompressed(
+		const void *data,
+		size_t dataSize,
+		int32_t level,
+		const Vector2u &size,
+		const Vector2i &offset
+		)
+	{
+		const Vector2u levelSize{std::max(1u, Size.Width >> level), std::max(1u, Size.Height >> level)};
+
+		ASSERT(size.Width + offset.X <= levelSize.Width && size.Height + offset.Y <= levelSize.Height);
+
+		if(size.Width + offset.X > levelSize.Width || size.Height + offset.Y > levelSize.Height)
+			throw std::out_of_range("Out of range");
+
+		if(data)
+			Functions.CompressedSubImage2D(Texture, level, offset, size, Format, dataSize, data);
+	}
+
 	void TextureObject::Internals::GenerateMipMaps()
 	{
 		MipMapGenerated = true;
@@ -67,19 +88,29 @@ namespace Game
 
 	std::vector<Color> TextureObject::Internals::Get(uint32_t level) const
 	{
-		std::vector<Color> pixels;
+		const auto size = GetLevelSize(level);
+
+		std::vector<Color> pixels(static_cast<size_t>(size.Width) * size.Height);
+		Get(level, pixels.data(), pixels.size());
+
+		return pixels;
+	}
 
-		pixels.resize(static_cast<std::vector<Color>::size_type>(Size.Width) * static_cast<std::vector<Color>::size_type>(Size.Height));
+	void TextureObject::Internals::Get(uint32_t level, Color *pixels, size_t size) const
+	{
 		Functions.GetTextureImage(
 		                          Texture,
 		                          static_cast<int32_t>(level),
 		                          Format::Rgba,
 		                          DataType::UnsignedByte,
-		                          static_cast<uint32_t>(pixels.size()),
-		                          pixels.data()
+		                          static_cast<uint32_t>(size * sizeof(Color)),
+		                          pixels
 		                         );
+	}
 
-		return pixels;
+	Vector2u TextureObject::Internals::GetLevelSize(uint32_t level) const
+	{
+		return {std::max(Size.Width >> level, 1u), std::max(Size.Height >> level, 1u)};
 	}
 
 	void TextureObject::Internals::SetFilter(const TextureFilter &filter)
@@ -196,6 +227,33 @@ namespace Game
 		Update(image, 0);
 	}
 
+	void TextureObject::Create(const CompressedImage &image)
+	{
+		ASSERT(!image.Empty(), "Empty image");
+		if(image.Empty())
+			throw std::invalid_argument("Empty image");
+
+		if(!IsFormatSupported(image.Format()))
+			throw std::runtime_error("Compressed texture format is not supported");
+
+		Create(image.Size(), image.Levels(), GetCompressedFormat(image.Format(), image.IsSrgb()));
+		Update(image);
+	}
+
+	void TextureObject::Create(const MipChain &chain, InternalFormat format)
+	{
+		ASSERT(!chain.Empty(), "Empty mip chain");
+		if(chain.Empty())
+			throw std::invalid_argument("Empty mip chain");
+
+		// sRGB encoded levels have to be decoded by the sampler, a plain RGBA8 texture would sample them as linear
+		if(chain.IsSrgb() && format == InternalFormat::RGBA8)
+			format = InternalFormat::SRGB8A8;
+
+		Create(chain.Size(), chain.Levels(), format);
+		Update(chain);
+	}
+
 	std::vector<Color> TextureObject::Get(uint32_t level) const
 	{
 		return m_Internals->Get(level);
@@ -203,7 +261,16 @@ namespace Game
 
 	Image TextureObject::ToImage(uint32_t level) const
 	{
-		return Image(Size(), Get(level).data());
+		Image image;
+		ToImage(image, level);
+
+		return image;
+	}
+
+	void TextureObject::ToImage(Image &image, uint32_t level) const
+	{
+		image.Resize(GetLevelSize(level));
+		m_Internals->Get(level, image.begin(), static_cast<size_t>(image.Width()) * image.Height());
 	}
 
 	void TextureObject::GenerateMipMaps()
@@ -352,6 +419,31 @@ namespace Game
 		Update(image.GetPixels(), level, image.Size(), offset);
 	}
 
+	void TextureObject::Update(const CompressedImage &image)
+	{
+		ASSERT(GetCompressedFormat(image.Format(), image.IsSrgb()) == GetInternalFormat(), "Format mismatch");
+		if(GetCompressedFormat(image.Format(), image.IsSrgb()) != GetInternalFormat())
+			throw std::invalid_argument("Format mismatch");
+
+		const uint32_t levels = std::min(image.Levels(), Levels());
+		for(uint32_t i = 0; i < levels; ++i)
+		{
+			const auto &level = image.GetLevel(i);
+			m_Internals->UpdateCompressed(level.Data.data(), level.Data.size(), static_cast<int32_t>(i), level.Size, {0, 0});
+		}
+
+		m_Internals->MipMapGenerated = levels > 1;
+	}
+
+	void TextureObject::Update(const MipChain &chain)
+	{
+		const uint32_t levels = std::min(chain.Levels(), Levels());
+		for(uint32_t i = 0; i < levels; ++i)
+			Update(chain.GetLevel(i), i);
+
+		m_Internals->MipMapGenerated = levels > 1;
+	}
+
 	uint32_t TextureObject::CalculateLevels(const Vector2u &size) {
 		return static_cast<uint32_t>(std::floor(
 		                                        std::log2(
@@ -394,4 +486,56 @@ namespace Game
 		s_Checked = true;
 		return s_Units = static_cast<uint32_t>(Context::GetContext()->GetFunctions().GetInteger64(GL_MAX_TEXTURE_IMAGE_UNITS));
 	}
+
+	InternalFormat TextureObject::GetCompressedFormat(CompressedFormat format, bool srgb)
+	{
+		switch(format)
+		{
+			case CompressedFormat::BC1:
+				return srgb ? InternalFormat::CompressedSRGBAS3TCDXT1 : InternalFormat::CompressedRGBAS3TCDXT1;
+			case CompressedFormat::BC2:
+				return srgb ? InternalFormat::CompressedSRGBAS3TCDXT3 : InternalFormat::CompressedRGBAS3TCDXT3;
+			case CompressedFormat::BC3:
+				return srgb ? InternalFormat::CompressedSRGBAS3TCDXT5 : InternalFormat::CompressedRGBAS3TCDXT5;
+			case CompressedFormat::BC4:
+				return InternalFormat::CompressedRedRGTC1;
+			case CompressedFormat::BC5:
+				return InternalFormat::CompressedRGRGTC2;
+			case CompressedFormat::BC7:
+				return srgb ? InternalFormat::CompressedSRGBABPTC : InternalFormat::CompressedRGBABPTC;
+			case CompressedFormat::ETC2RGB:
+				return srgb ? InternalFormat::CompressedSRGB8ETC2 : InternalFormat::CompressedRGB8ETC2;
+			case CompressedFormat::ETC2RGBA:
+				return srgb ? InternalFormat::CompressedSRGB8A8ETC2EAC : InternalFormat::CompressedRGBA8ETC2EAC;
+			default:
+				throw std::invalid_argument("Unknown compressed format");
+		}
+	}
+
+	bool TextureObject::IsFormatSupported(CompressedFormat format)
+	{
+		static bool s_Checked = false;
+		static bool s_S3TC    = false;
+
+		switch(format)
+		{
+			case CompressedFormat::BC1:
+			case CompressedFormat::BC2:
+			case CompressedFormat::BC3:
+				if(!s_Checked)
+				{
+					ASSERT(Context::GetContext(), "No active openGL context");
+
+					if (!Context::GetContext())
+						throw std::runtime_error("No active openGL context");
+
+					s_Checked = true;
+					s_S3TC    = Context::GetContext()->IsExtensionSupported("GL_EXT_texture_compression_s3tc");
+				}
+
+				return s_S3TC;
+			default:
+				return true;
+		}
+	}
 }
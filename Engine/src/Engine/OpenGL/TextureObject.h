@@ -9,8 +9,12 @@
 namespace Game
 {
 	class Image;
+	class CompressedImage;
+	class MipChain;
 	class FrameBufferObject;
 
+	enum class CompressedFormat;
+
 	struct TextureWrapping
 	{
 		Wrapping S = Wrapping::Repeat;
@@ -28,6 +32,8 @@ namespace Game
 	{
 	public:
 		friend FrameBufferObject;
+		friend class TextureLoader;
+		friend class RenderTargetPool;
 
 		using IDType = uint32_t;
 
@@ -73,9 +79,20 @@ namespace Game
 				const Vector2i &offset
 				);
 
+			void UpdateCompressed(
+				const void *data,
+				size_t dataSize,
+				int32_t level,
+				const Vector2u &size,
+				const Vector2i &offset
+				);
+
 			void GenerateMipMaps();
 
 			[[nodiscard]] std::vector<Color> Get(uint32_t level = 0) const;
+			void Get(uint32_t level, Color *pixels, size_t size) const;
+
+			[[nodiscard]] Vector2u GetLevelSize(uint32_t level) const;
 
 			void SetFilter(const TextureFilter &filter);
 
@@ -130,6 +147,11 @@ namespace Game
 		[[nodiscard]] std::vector<Color> Get(uint32_t level = 0) const;
 		[[nodiscard]] Image ToImage(uint32_t level = 0) const;
 
+		// Reads into the existing storage of the image, reusing it when it is large enough
+		void ToImage(Image &image, uint32_t level = 0) const;
+
+		[[nodiscard]] Vector2u GetLevelSize(uint32_t level) const { return m_Internals->GetLevelSize(level); }
+
 		[[nodiscard]] Filter GetFilterMin() const { return m_Internals->Filter.Min; }
 		[[nodiscard]] Filter GetFilterMag() const { return m_Internals->Filter.Mag; }
 
@@ -151,6 +173,9 @@ namespace Game
 
 		void Create(const Vector2u &size, uint32_t levels = 1, InternalFormat format = InternalFormat::RGBA8);
 		void Create(const Image &image, uint32_t levels = 1, InternalFormat format = InternalFormat::RGBA8);
+		void Create(const CompressedImage &image);
+		// An sRGB chain is stored as SRGB8A8 when the default format is left in place
+		void Create(const MipChain &chain, InternalFormat format = InternalFormat::RGBA8);
 
 		void GenerateMipMaps();
 
@@ -185,11 +210,17 @@ namespace Game
 		void Update(const Image &image, uint32_t level, int32_t x, int32_t y);
 		void Update(const Image &image, uint32_t level, const Vector2i &offset);
 
+		void Update(const CompressedImage &image);
+		void Update(const MipChain &chain);
+
 	protected:
 		static uint32_t CalculateLevels(const Vector2u &size);
 
 	public:
 		static uint64_t MaxBufferSize();
 		static uint64_t MaxImageUnits();
+
+		static InternalFormat GetCompressedFormat(CompressedFormat format, bool srgb = false);
+		static bool IsFormatSupported(CompressedFormat format);
 	};
 }
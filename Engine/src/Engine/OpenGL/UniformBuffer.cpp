@@ -15,6 +15,25 @@ namespace Game
 		delete[] Data;
 	}
 
+	void UniformBuffer::Internals::MarkDirty(size_t offset, size_t size)
+	{
+		if(!IsDirty())
+		{
+			DirtyBegin = offset;
+			DirtyEnd   = offset + size;
+			return;
+		}
+
+		DirtyBegin = std::min(DirtyBegin, offset);
+		DirtyEnd   = std::max(DirtyEnd, offset + size);
+	}
+
+	void UniformBuffer::Internals::ClearDirty()
+	{
+		DirtyBegin = 0;
+		DirtyEnd   = 0;
+	}
+
 	UniformBuffer::UniformBuffer(
 		const ShaderProgram &program,
 		const std::string &name,
@@ -44,6 +63,36 @@ namespace Game
 	{
 		Data(usage, Size(), m_Internals->Data);
 		m_Internals->Usage = usage;
+		m_Internals->ClearDirty();
+	}
+
+	void UniformBuffer::OrphanThreshold(float threshold)
+	{
+		m_Internals->OrphanThreshold = std::clamp(threshold, 0.f, 1.f);
+	}
+
+	void UniformBuffer::Flush() const
+	{
+		if(!m_Internals->IsDirty())
+			return;
+
+		auto buffer = const_cast<UniformBuffer*>(this);
+
+		const size_t offset = m_Internals->DirtyBegin;
+		const size_t size   = m_Internals->DirtyEnd - m_Internals->DirtyBegin;
+
+		if(static_cast<float>(size) >= m_Internals->OrphanThreshold * static_cast<float>(Size()))
+			buffer->Data(m_Internals->Usage, Size(), m_Internals->Data);
+		else
+			buffer->SubData(size, offset, m_Internals->Data + offset);
+
+		m_Internals->ClearDirty();
+	}
+
+	void UniformBuffer::Bind() const
+	{
+		Flush();
+		BufferObject::Bind();
 	}
 
 	void UniformBuffer::Set(const void *data, size_t size, size_t offset)
@@ -53,7 +102,7 @@ namespace Game
 			throw std::out_of_range("Out of Range");
 
 		std::memcpy(m_Internals->Data + offset, data, size);
-		SubData(size, offset, data);
+		m_Internals->MarkDirty(offset, size);
 	}
 
 	void UniformBuffer::Set(glm::vec2 &value, size_t offset)
@@ -73,13 +122,11 @@ namespace Game
 
 	void UniformBuffer::Set(glm::mat3 &value, size_t offset)
 	{
-		for(uint32_t i = 0; i < 3; ++i)
-			Set(value[i], offset + i * sizeof(glm::vec3));
+		Set(&value[0].x, sizeof(glm::mat3), offset);
 	}
 
 	void UniformBuffer::Set(glm::mat4 &value, size_t offset)
 	{
-		for(uint32_t i = 0; i < 4; ++i)
-			Set(value[i], offset + i * sizeof(glm::vec4));
+		Set(&value[0].x, sizeof(glm::mat4), offset);
 	}
 }
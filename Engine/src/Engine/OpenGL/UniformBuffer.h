@@ -12,8 +12,18 @@ namespace Game
 			char *Data;
 			BufferUsage Usage;
 
+			size_t DirtyBegin = 0;
+			size_t DirtyEnd   = 0;
+
+			float OrphanThreshold = 0.75f;
+
 			Internals(uint32_t size, BufferUsage usage);
 			~Internals();
+
+			bool IsDirty() const { return DirtyEnd > DirtyBegin; }
+
+			void MarkDirty(size_t offset, size_t size);
+			void ClearDirty();
 		};
 
 		Pointer<Internals> m_Internals;
@@ -26,6 +36,14 @@ namespace Game
 		BufferUsage Usage() const { return m_Internals->Usage; }
 		void Usage(BufferUsage usage);
 
+		float OrphanThreshold() const { return m_Internals->OrphanThreshold; }
+		void OrphanThreshold(float threshold);
+
+		bool IsDirty() const { return m_Internals->IsDirty(); }
+
+		void Flush() const;
+		void Bind() const;
+
 		void* Get() { return m_Internals->Data; }
 		const void* Get() const { return m_Internals->Data; }
 
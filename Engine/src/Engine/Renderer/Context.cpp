@@ -8,13 +8,19 @@
 
 #include "Assert.h"
 #include "Engine/Core/Window.h"
+#include "Engine/OpenGL/GLBackend.h"
 
 namespace Game
 {
 	Context::~Context()
 	{
-		s_Context = nullptr;
-		s_Contests[std::this_thread::get_id()] = nullptr;
+		Unregister();
+
+		if(s_Context == this)
+			s_Context = nullptr;
+
+		if(m_OwnsWindow)
+			glfwDestroyWindow(static_cast<GLFWwindow*>(m_WindowHandler));
 	}
 
 	Scope<Context> Context::Create(const Window& window)
@@ -22,11 +28,42 @@ namespace Game
 		return Scope<Context>(new Context(window.GetNativeWindow()));
 	}
 
+	Scope<Context> Context::CreateShared(const Context &context)
+	{
+		const auto previous = s_Context;
+
+		glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+		const auto window = glfwCreateWindow(1, 1, "Shared context", nullptr, static_cast<GLFWwindow*>(context.m_WindowHandler));
+		glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+
+		ASSERT(window, "Failed to create shared context");
+		if(!window)
+			throw std::runtime_error("Failed to create shared context");
+
+		auto shared = Scope<Context>(new Context(window, &context, true));
+		shared->Release();
+
+		if(previous)
+			previous->MakeCurrent();
+
+		return shared;
+	}
+
+	Scope<Context> Context::CreateNull()
+	{
+		return Scope<Context>(new Context(nullptr));
+	}
+
 	OpenGLVersion Context::GetVersion() const
 	{
 		return m_Version;
 	}
 
+	bool Context::IsExtensionSupported(const std::string &name) const
+	{
+		return m_Extensions.contains(name);
+	}
+
 	bool Context::operator==(const Context &context) const
 	{
 		return m_ThreadId == context.m_ThreadId && m_WindowHandler == context.m_WindowHandler;
@@ -34,30 +71,61 @@ namespace Game
 
 	bool Context::operator!=(const Context &context) const
 	{
-		return m_ThreadId != context.m_ThreadId && m_WindowHandler == context.m_WindowHandler;
+		return !(*this == context);
 	}
 
 	void Context::SwapBuffers()
 	{
-		glfwSwapBuffers(static_cast<GLFWwindow*>(m_WindowHandler));
+		if(m_WindowHandler)
+			glfwSwapBuffers(static_cast<GLFWwindow*>(m_WindowHandler));
 	}
 
 	void Context::MakeCurrent()
 	{
-		glfwMakeContextCurrent(static_cast<GLFWwindow*>(m_WindowHandler));
+		if(s_Context && s_Context != this)
+			s_Context->Unregister();
+
+		if(m_WindowHandler)
+			glfwMakeContextCurrent(static_cast<GLFWwindow*>(m_WindowHandler));
+
 		m_ThreadId = std::this_thread::get_id();
-		m_Functions->MakeCurrent();
+
+		if(m_Functions)
+			m_Functions->MakeCurrent();
+
 		s_Context = this;
-		s_Contests[std::this_thread::get_id()] = this;
+		Register();
+	}
+
+	void Context::Release()
+	{
+		ASSERT(s_Context == this, "Context is not current on this thread");
+		if(s_Context != this)
+			return;
+
+		Unregister();
+
+		if(m_WindowHandler)
+			glfwMakeContextCurrent(nullptr);
+
+		s_Context  = nullptr;
+		m_ThreadId = {};
 	}
 
 	bool Context::IsCurrent() const
 	{
-		return std::this_thread::get_id() == m_ThreadId;
+		return s_Context == this;
+	}
+
+	bool Context::IsShareGroupCurrent() const
+	{
+		return s_Context && s_Context->m_ShareGroup == m_ShareGroup;
 	}
 
 	Context * Context::GetCurrentContext()
 	{
+		std::scoped_lock lock(s_Mutex);
+
 		const auto context = s_Contests.find(std::this_thread::get_id());
 		if (context != s_Contests.end())
 			return context->second;
@@ -70,16 +138,42 @@ namespace Game
 		return s_Context;
 	}
 
-	Context::Context(void *windowHandler) : m_WindowHandler(windowHandler), m_ThreadId(std::this_thread::get_id())
+	Context::Context(void *windowHandler, const Context *shared, bool ownsWindow) : m_WindowHandler(windowHandler),
+		m_OwnsWindow(ownsWindow),
+		m_ThreadId(std::this_thread::get_id())
 	{
+		{
+			std::scoped_lock lock(s_Mutex);
+			m_ShareGroup = shared ? shared->m_ShareGroup : ++s_ShareGroups;
+		}
+
 		MakeCurrent();
-		const int status = gladLoadGLLoader((GLADloadproc)glfwGetProcAddress);
 
-		ASSERT(status, "Failed to initialize Glad!");
-		if (!status)
-			throw std::runtime_error("Failed to initialize Glad!");
+		if(m_WindowHandler)
+		{
+			static std::once_flag s_GladLoaded;
+			static int status = 0;
+
+			std::call_once(s_GladLoaded, []() { status = gladLoadGLLoader((GLADloadproc)glfwGetProcAddress); });
+
+			ASSERT(status, "Failed to initialize Glad!");
+			if (!status)
+				throw std::runtime_error("Failed to initialize Glad!");
+		}
+		else if(GLBackend::GetType() == GLBackendType::Native)
+			GLBackend::Install(GLBackendType::Null);
 
 		m_Functions = Scope<OpenGlFunctions>(new OpenGlFunctions(*this));
+		m_Functions->MakeCurrent();
+
+		if(shared)
+		{
+			m_Version    = shared->m_Version;
+			m_Extensions = shared->m_Extensions;
+
+			LOG_INFO("Created shared OpenGL context (share group: {})", m_ShareGroup);
+			return;
+		}
 
 		LOG_INFO("OpenGL Info: ");
 		LOG_INFO(" Vedor: {0}", (const char*)glGetString(GL_VENDOR));
@@ -87,5 +181,33 @@ namespace Game
 		LOG_INFO(" Version: {0}", (const char*)glGetString(GL_VERSION));
 
 		m_Version = {m_Functions->GetInteger(GL_MAJOR_VERSION), m_Functions->GetInteger(GL_MINOR_VERSION)};
+
+		const int32_t extensions = m_Functions->GetInteger(GL_NUM_EXTENSIONS);
+		m_Extensions.reserve(extensions);
+
+		for(int32_t i = 0; i < extensions; ++i)
+			m_Extensions.emplace(m_Functions->GetString(GL_EXTENSIONS, i));
+
+		LOG_INFO(" Extensions: {0}", extensions);
+	}
+
+	void Context::Register()
+	{
+		std::scoped_lock lock(s_Mutex);
+		s_Contests[m_ThreadId] = this;
+	}
+
+	void Context::Unregister()
+	{
+		std::scoped_lock lock(s_Mutex);
+
+		for(auto it = s_Contests.begin(); it != s_Contests.end(); ++it)
+		{
+			if(it->second == this)
+			{
+				s_Contests.erase(it);
+				break;
+			}
+		}
 	}
 }
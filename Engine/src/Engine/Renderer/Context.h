@@ -3,7 +3,10 @@
 #include "Engine/Core/Base.h"
 #include "Engine/OpenGL/OpenGlFunctions.h"
 
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace Game
 {
@@ -17,12 +20,18 @@ namespace Game
 
 	class Context
 	{
-		static inline std::unordered_map<std::thread::id, Context*> s_Contests; 
+		static inline std::unordered_map<std::thread::id, Context*> s_Contests;
+		static inline std::mutex s_Mutex;
 		static inline thread_local Context* s_Context = nullptr;
+		static inline uint32_t s_ShareGroups = 0;
 		
 		void *m_WindowHandler = nullptr;
+		bool m_OwnsWindow     = false;
+		uint32_t m_ShareGroup = 0;
+
 		Scope<OpenGlFunctions> m_Functions = nullptr;
 		OpenGLVersion m_Version;
+		std::unordered_set<std::string> m_Extensions;
 		
 		std::thread::id m_ThreadId;
 	public:
@@ -35,8 +44,13 @@ namespace Game
 		~Context();
 
 		static Scope<Context> Create(const Window& window);
+		static Scope<Context> CreateShared(const Context &context);
+
+		// Context without a window whose calls go to the null GL backend, for running without a driver
+		static Scope<Context> CreateNull();
 
 		[[nodiscard]] OpenGLVersion GetVersion() const;
+		[[nodiscard]] bool IsExtensionSupported(const std::string &name) const;
 
 		bool operator==(const Context &context) const;
 		bool operator!=(const Context &context) const;
@@ -44,12 +58,21 @@ namespace Game
 		void SwapBuffers();
 		[[nodiscard]] OpenGlFunctions GetFunctions() const { return *m_Functions; }
 		void MakeCurrent();
+		void Release();
 
+		// Container objects (vertex arrays, framebuffers, program pipelines, queries) and state belong to this context alone
 		[[nodiscard]] bool IsCurrent() const;
+		// Some context of the share group is current, enough for buffers, textures, renderbuffers, shaders, programs and syncs
+		[[nodiscard]] bool IsShareGroupCurrent() const;
+		[[nodiscard]] bool IsShared(const Context &context) const { return m_ShareGroup == context.m_ShareGroup; }
+		[[nodiscard]] bool IsNull() const { return m_WindowHandler == nullptr; }
 
 		static Context* GetCurrentContext();
 		static Context* GetContext();
 	private:
-		Context(void *windowHandler);
+		Context(void *windowHandler, const Context *shared = nullptr, bool ownsWindow = false);
+
+		void Register();
+		void Unregister();
 	};
 }
@@ -0,0 +1,81 @@
+#include "pch.h"
+#include "Engine/Renderer/ContextWorker.h"
+
+namespace Game
+{
+	ContextWorker::ContextWorker(const Context &context, std::string name) : m_Name(std::move(name))
+	{
+		m_Context = Context::CreateShared(context);
+		m_Thread  = std::thread([this]() { Run(); });
+
+		GL_LOG_DEBUG("Started {}", m_Name);
+	}
+
+	ContextWorker::~ContextWorker()
+	{
+		{
+			std::scoped_lock lock(m_Mutex);
+			m_Stop = true;
+		}
+
+		m_Condition.notify_all();
+
+		if(m_Thread.joinable())
+			m_Thread.join();
+
+		m_Context = nullptr;
+
+		GL_LOG_DEBUG("Stopped {}", m_Name);
+	}
+
+	size_t ContextWorker::Pending()
+	{
+		std::scoped_lock lock(m_Mutex);
+		return m_Jobs.size();
+	}
+
+	void ContextWorker::Enqueue(std::function<void()> job)
+	{
+		{
+			std::scoped_lock lock(m_Mutex);
+
+			ASSERT(!m_Stop, "Context worker is stopped");
+			if(m_Stop)
+				throw std::runtime_error("Context worker is stopped");
+
+			m_Jobs.emplace_back(std::move(job));
+		}
+
+		m_Condition.notify_one();
+	}
+
+	void ContextWorker::Run()
+	{
+		m_Context->MakeCurrent();
+
+		auto functions = m_Context->GetFunctions();
+
+		while(true)
+		{
+			std::function<void()> job;
+
+			{
+				std::unique_lock lock(m_Mutex);
+				m_Condition.wait(lock, [this]() { return m_Stop || !m_Jobs.empty(); });
+
+				if(m_Stop && m_Jobs.empty())
+					break;
+
+				job = std::move(m_Jobs.front());
+				m_Jobs.pop_front();
+			}
+
+			job();
+
+			// Make the job's commands visible to the other contexts of the share group
+			functions.Flush();
+		}
+
+		m_Context->Release();
+	}
+}
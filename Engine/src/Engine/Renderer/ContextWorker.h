@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/Renderer/Context.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+namespace Game
+{
+	class ContextWorker
+	{
+		std::string m_Name;
+		Scope<Context> m_Context;
+
+		std::deque<std::function<void()>> m_Jobs;
+		std::mutex m_Mutex;
+		std::condition_variable m_Condition;
+
+		bool m_Stop = false;
+		std::thread m_Thread;
+
+	public:
+		explicit ContextWorker(const Context &context, std::string name = "Context worker");
+		~ContextWorker();
+
+		ContextWorker(const ContextWorker&) = delete;
+		ContextWorker(ContextWorker&&) = delete;
+
+		ContextWorker& operator=(const ContextWorker&) = delete;
+		ContextWorker& operator=(ContextWorker&&) = delete;
+
+		template <typename Func>
+		auto Submit(Func &&func) -> std::future<std::invoke_result_t<Func>>
+		{
+			using ReturnType = std::invoke_result_t<Func>;
+
+			auto job    = MakePointer<std::packaged_task<ReturnType()>>(std::forward<Func>(func));
+			auto future = job->get_future();
+
+			Enqueue([job]() { (*job)(); });
+
+			return future;
+		}
+
+		size_t Pending();
+
+		const std::string& GetName() const { return m_Name; }
+		const Context& GetContext() const { return *m_Context; }
+
+	private:
+		void Enqueue(std::function<void()> job);
+		void Run();
+	};
+}
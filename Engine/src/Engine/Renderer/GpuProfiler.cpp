@@ -0,0 +1,293 @@
+#include "pch.h"
+#include "Engine/Renderer/GpuProfiler.h"
+
+#include "Engine/Renderer/Context.h"
+
+namespace
+{
+	std::string Escape(std::string_view text)
+	{
+		std::string result;
+		result.reserve(text.size());
+
+		for(const char c : text)
+		{
+			if(c == '"' || c == '\\')
+				result += '\\';
+
+			result += c;
+		}
+
+		return result;
+	}
+
+	double ToTraceTime(const Game::Time &time)
+	{
+		return static_cast<double>(time.AsNanoseconds()) / 1000.0;
+	}
+
+	std::string TraceEvent(std::string_view name, std::string_view category, const Game::Time &start, const Game::Time &duration, uint32_t thread)
+	{
+		return fmt::format(
+		                   R"({{"name":"{}","cat":"{}","ph":"X","ts":{:.3f},"dur":{:.3f},"pid":0,"tid":{}}})",
+		                   Escape(name),
+		                   category,
+		                   ToTraceTime(start),
+		                   ToTraceTime(duration),
+		                   thread
+		                  );
+	}
+}
+
+namespace Game
+{
+	std::array<GpuProfiler::Frame, GpuProfiler::FRAME_LATENCY> GpuProfiler::s_Frames;
+
+	void GpuProfiler::BeginFrame()
+	{
+		if(s_InFrame)
+			EndFrame();
+
+		if(!s_Enabled || !Context::GetContext())
+			return;
+
+		ResolveReady();
+
+		auto &frame = s_Frames[s_FrameNumber % FRAME_LATENCY];
+
+		if(frame.Pending)
+		{
+			GL_LOG_TRACE("GPU is {} frames behind, dropping profiler results of frame {}", FRAME_LATENCY, frame.Number);
+			frame.Pending = false;
+		}
+
+		frame.Used   = 0;
+		frame.Number = s_FrameNumber;
+		frame.Start  = Now();
+		frame.Zones.clear();
+
+		s_InFrame = true;
+		BeginZone("Frame");
+	}
+
+	void GpuProfiler::EndFrame()
+	{
+		if(!s_InFrame)
+			return;
+
+		if(s_Open.size() > 1)
+			GL_LOG_WARN("{} profiler zones were not closed before the end of the frame", s_Open.size() - 1);
+
+		while(!s_Open.empty())
+			EndZone();
+
+		auto &frame   = s_Frames[s_FrameNumber % FRAME_LATENCY];
+		frame.Pending = !frame.Zones.empty();
+
+		s_InFrame = false;
+		++s_FrameNumber;
+	}
+
+	void GpuProfiler::BeginZone(std::string_view name)
+	{
+		if(!s_InFrame)
+			return;
+
+		auto &frame = s_Frames[s_FrameNumber % FRAME_LATENCY];
+
+		auto &zone    = frame.Zones.emplace_back();
+		zone.Name     = name;
+		zone.Depth    = static_cast<uint32_t>(s_Open.size());
+		zone.Begin    = AllocateQuery(frame);
+		zone.CpuBegin = Now();
+
+		Context::GetContext()->GetFunctions().QueryCounter(frame.Queries[zone.Begin]);
+
+		s_Open.emplace_back(static_cast<uint32_t>(frame.Zones.size() - 1));
+	}
+
+	void GpuProfiler::EndZone()
+	{
+		if(!s_InFrame || s_Open.empty())
+			return;
+
+		auto &frame = s_Frames[s_FrameNumber % FRAME_LATENCY];
+		auto &zone  = frame.Zones[s_Open.back()];
+
+		s_Open.pop_back();
+
+		zone.End = AllocateQuery(frame);
+		Context::GetContext()->GetFunctions().QueryCounter(frame.Queries[zone.End]);
+
+		zone.CpuEnd = Now();
+	}
+
+	const ProfileFrame* GpuProfiler::GetLastFrame()
+	{
+		return s_History.empty() ? nullptr : &s_History.back();
+	}
+
+	bool GpuProfiler::SaveTrace(const std::filesystem::path &path)
+	{
+		std::ofstream file(path, std::ios::trunc);
+
+		if(!file.is_open())
+		{
+			LOG_ERROR("Unable to open trace file: {}", path.string());
+			return false;
+		}
+
+		file << R"({"traceEvents":[)";
+		file << R"({"name":"thread_name","ph":"M","pid":0,"tid":0,"args":{"name":"CPU"}},)";
+		file << R"({"name":"thread_name","ph":"M","pid":0,"tid":1,"args":{"name":"GPU"}})";
+
+		// The GPU clock is unrelated to the CPU one, GPU zones are placed relative to the CPU start of their frame
+		for(const auto &frame : s_History)
+		{
+			for(const auto &zone : frame.Zones)
+			{
+				file << ',' << TraceEvent(
+				                          zone.Name,
+				                          "cpu",
+				                          frame.Start + zone.CpuStart,
+				                          zone.CpuTime,
+				                          0
+				                         );
+				file << ',' << TraceEvent(
+				                          zone.Name,
+				                          "gpu",
+				                          frame.Start + zone.GpuStart,
+				                          zone.GpuTime,
+				                          1
+				                         );
+			}
+		}
+
+		file << "]}";
+
+		LOG_INFO("Saved {} profiled frames to {}", s_History.size(), path.string());
+		return true;
+	}
+
+	void GpuProfiler::SetEnabled(bool enabled)
+	{
+		s_Enabled = enabled;
+	}
+
+	void GpuProfiler::SetHistoryLimit(size_t frames)
+	{
+		s_HistoryLimit = std::max<size_t>(frames, 1);
+
+		while(s_History.size() > s_HistoryLimit)
+			s_History.pop_front();
+	}
+
+	void GpuProfiler::Shutdown()
+	{
+		const auto context = Context::GetContext();
+
+		for(auto &frame : s_Frames)
+		{
+			if(context && !frame.Queries.empty())
+				context->GetFunctions().DeleteQueries(static_cast<uint32_t>(frame.Queries.size()), frame.Queries.data());
+
+			frame = Frame();
+		}
+
+		s_Open.clear();
+		s_History.clear();
+		s_InFrame = false;
+	}
+
+	uint32_t GpuProfiler::AllocateQuery(Frame &frame)
+	{
+		if(frame.Used == frame.Queries.size())
+		{
+			frame.Queries.resize(frame.Queries.size() + QUERY_BATCH);
+			Context::GetContext()->GetFunctions().CreateQueries(GL_TIMESTAMP, QUERY_BATCH, frame.Queries.data() + frame.Used);
+		}
+
+		return frame.Used++;
+	}
+
+	// Timestamps complete in submission order, once the last one is available so are the others
+	bool GpuProfiler::IsReady(const Frame &frame)
+	{
+		return frame.Used == 0 || Context::GetContext()->GetFunctions().IsQueryResultAvailable(frame.Queries[frame.Used - 1]);
+	}
+
+	void GpuProfiler::Resolve(Frame &frame)
+	{
+		const auto functions = Context::GetContext()->GetFunctions();
+
+		ProfileFrame result;
+		result.Number = frame.Number;
+		result.Start  = frame.Start;
+		result.Zones.reserve(frame.Zones.size());
+
+		const uint64_t origin = functions.GetQueryResult(frame.Queries[frame.Zones.front().Begin]);
+
+		for(const auto &zone : frame.Zones)
+		{
+			const uint64_t begin = functions.GetQueryResult(frame.Queries[zone.Begin]);
+			const uint64_t end   = functions.GetQueryResult(frame.Queries[zone.End]);
+
+			auto &profiled    = result.Zones.emplace_back();
+			profiled.Name     = zone.Name;
+			profiled.Depth    = zone.Depth;
+			profiled.CpuStart = zone.CpuBegin - frame.Start;
+			profiled.CpuTime  = zone.CpuEnd - zone.CpuBegin;
+			profiled.GpuStart = Nanoseconds(static_cast<int64_t>(begin - origin));
+			profiled.GpuTime  = Nanoseconds(static_cast<int64_t>(end - begin));
+		}
+
+		s_History.emplace_back(std::move(result));
+
+		while(s_History.size() > s_HistoryLimit)
+			s_History.pop_front();
+
+		frame.Pending = false;
+	}
+
+	void GpuProfiler::ResolveReady()
+	{
+		for(uint32_t i = FRAME_LATENCY; i > 0; --i)
+		{
+			if(s_FrameNumber < i)
+				continue;
+
+			const uint64_t number = s_FrameNumber - i;
+			auto &frame           = s_Frames[number % FRAME_LATENCY];
+
+			if(!frame.Pending || frame.Number != number)
+				continue;
+
+			if(!IsReady(frame))
+				break;
+
+			Resolve(frame);
+		}
+	}
+
+	GpuZone::GpuZone(std::string_view name)
+	{
+		if(const auto context = Context::GetContext())
+		{
+			context->GetFunctions().PushDebugGroup(name);
+			m_DebugGroup = true;
+		}
+
+		GpuProfiler::BeginZone(name);
+	}
+
+	GpuZone::~GpuZone()
+	{
+		GpuProfiler::EndZone();
+
+		if(m_DebugGroup)
+		{
+			if(const auto context = Context::GetContext())
+				context->GetFunctions().PopDebugGroup();
+		}
+	}
+}
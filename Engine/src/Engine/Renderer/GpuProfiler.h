@@ -0,0 +1,130 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/Core/Clock.h"
+
+#include <array>
+#include <deque>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Game
+{
+	struct ProfileZone
+	{
+		std::string Name;
+		uint32_t Depth = 0;
+
+		// Both starts are relative to the beginning of the frame
+		Time CpuStart;
+		Time CpuTime;
+		Time GpuStart;
+		Time GpuTime;
+	};
+
+	struct ProfileFrame
+	{
+		uint64_t Number = 0;
+		Time Start;
+
+		std::vector<ProfileZone> Zones;
+	};
+
+	// Timestamp queries are kept in a ring of frames and read back once the GPU is done with them, so reading results
+	// never stalls the pipeline. Zones may nest, the first zone of every frame covers the whole frame
+	class GpuProfiler
+	{
+		static constexpr uint32_t FRAME_LATENCY = 4;
+		static constexpr uint32_t QUERY_BATCH   = 32;
+
+		struct Zone
+		{
+			std::string Name;
+			uint32_t Depth = 0;
+
+			Time CpuBegin;
+			Time CpuEnd;
+
+			uint32_t Begin = 0;
+			uint32_t End   = 0;
+		};
+
+		struct Frame
+		{
+			std::vector<uint32_t> Queries;
+			uint32_t Used = 0;
+
+			std::vector<Zone> Zones;
+
+			uint64_t Number = 0;
+			Time Start;
+			bool Pending = false;
+		};
+
+		static std::array<Frame, FRAME_LATENCY> s_Frames;
+		static inline std::vector<uint32_t> s_Open;
+
+		static inline std::deque<ProfileFrame> s_History;
+		static inline size_t s_HistoryLimit = 300;
+
+		static inline uint64_t s_FrameNumber = 0;
+		static inline bool s_InFrame         = false;
+		static inline bool s_Enabled         = true;
+
+		// Zones are timed with the timestamp counter, relative to when the profiler was loaded
+		static inline Time s_Origin = Clock::Now();
+
+	public:
+		static void BeginFrame();
+		static void EndFrame();
+
+		static void BeginZone(std::string_view name);
+		static void EndZone();
+
+		// Latest frame whose queries were resolved, usually FRAME_LATENCY - 1 frames behind
+		static const ProfileFrame* GetLastFrame();
+		static const std::deque<ProfileFrame>& GetHistory() { return s_History; }
+
+		// Chrome trace event format, loadable in chrome://tracing or Perfetto
+		static bool SaveTrace(const std::filesystem::path &path);
+
+		static void SetEnabled(bool enabled);
+		static bool IsEnabled() { return s_Enabled; }
+
+		static void SetHistoryLimit(size_t frames);
+		static size_t GetHistoryLimit() { return s_HistoryLimit; }
+
+		static void Shutdown();
+
+	private:
+		static Time Now() { return FastClock::Now() - s_Origin; }
+
+		static uint32_t AllocateQuery(Frame &frame);
+
+		static bool IsReady(const Frame &frame);
+		static void Resolve(Frame &frame);
+		static void ResolveReady();
+	};
+
+	class GpuZone
+	{
+		bool m_DebugGroup = false;
+
+	public:
+		explicit GpuZone(std::string_view name);
+		~GpuZone();
+
+		GpuZone(const GpuZone&) = delete;
+		GpuZone& operator=(const GpuZone&) = delete;
+	};
+}
+
+#ifdef GAME_ENABLE_PROFILING
+	#define GPU_ZONE_CONCAT_IMPL(a, b) a##b
+	#define GPU_ZONE_CONCAT(a, b) GPU_ZONE_CONCAT_IMPL(a, b)
+	#define GPU_ZONE(name) ::Game::GpuZone GPU_ZONE_CONCAT(gpuZone, __LINE__)(name)
+#else
+	#define GPU_ZONE(name)
+#endif
@@ -0,0 +1,430 @@
+#include "pch.h"
+#include "Engine/Renderer/RenderGraph.h"
+
+#include "Engine/OpenGL/Texture.h"
+#include "Engine/Renderer/GpuProfiler.h"
+
+namespace Game
+{
+	static constexpr bool IsDepthFormat(InternalFormat format)
+	{
+		switch(format)
+		{
+			case InternalFormat::DepthComponent:
+			case InternalFormat::DepthComponent16:
+			case InternalFormat::DepthComponent24:
+			case InternalFormat::DepthComponent32F:
+			case InternalFormat::DepthStencil:
+			case InternalFormat::Depth24Stencil8:
+			case InternalFormat::Depth32FStencil8:
+				return true;
+			default:
+				return false;
+		}
+	}
+
+	static constexpr bool HasStencil(InternalFormat format)
+	{
+		return format == InternalFormat::DepthStencil || format == InternalFormat::Depth24Stencil8 || format == InternalFormat::Depth32FStencil8;
+	}
+
+	RenderGraphHandle RenderGraphBuilder::Create(const std::string &name, const RenderTargetDescription &description)
+	{
+		ASSERT(description.Size.Width > 0 && description.Size.Height > 0, "Empty render graph texture");
+		if(description.Size.Width == 0 || description.Size.Height == 0)
+			throw std::invalid_argument("Empty render graph texture");
+
+		auto &resource       = m_Graph.m_Resources.emplace_back();
+		resource.Name        = name;
+		resource.Description = description;
+
+		const auto handle = m_Graph.CreateNode(static_cast<uint32_t>(m_Graph.m_Resources.size() - 1), 0, m_Pass);
+		m_Graph.m_Passes[m_Pass].Writes.emplace_back(handle.Index);
+
+		return handle;
+	}
+
+	RenderGraphHandle RenderGraphBuilder::Read(RenderGraphHandle handle)
+	{
+		ASSERT(handle.Index < m_Graph.m_Nodes.size(), "Invalid render graph handle");
+		if(handle.Index >= m_Graph.m_Nodes.size())
+			throw std::invalid_argument("Invalid render graph handle");
+
+		m_Graph.m_Passes[m_Pass].Reads.emplace_back(handle.Index);
+		return handle;
+	}
+
+	RenderGraphHandle RenderGraphBuilder::Write(RenderGraphHandle handle)
+	{
+		// Writing keeps the previous contents, so whoever produced them has to stay alive
+		Read(handle);
+
+		const auto &node  = m_Graph.m_Nodes[handle.Index];
+		const auto result = m_Graph.CreateNode(node.Resource, node.Version + 1, m_Pass);
+
+		m_Graph.m_Passes[m_Pass].Writes.emplace_back(result.Index);
+		return result;
+	}
+
+	void RenderGraphBuilder::SideEffect()
+	{
+		m_Graph.m_Passes[m_Pass].SideEffect = true;
+	}
+
+	Ref<Texture> RenderGraphResources::GetTexture(RenderGraphHandle handle) const
+	{
+		const auto &pass = m_Graph.m_Passes[m_Pass];
+
+		const bool declared = std::ranges::find(pass.Reads, handle.Index) != pass.Reads.end() ||
+		                      std::ranges::find(pass.Writes, handle.Index) != pass.Writes.end();
+
+		ASSERT(declared, fmt::format("Resource was not declared by pass \"{}\"", pass.Name));
+		if(!declared)
+			throw std::invalid_argument(fmt::format("Resource was not declared by pass \"{}\"", pass.Name));
+
+		return m_Graph.GetTexture(m_Graph.GetResource(handle));
+	}
+
+	const RenderTargetDescription& RenderGraphResources::GetDescription(RenderGraphHandle handle) const
+	{
+		return m_Graph.GetResource(handle).Description;
+	}
+
+	FrameBufferObject& RenderGraphResources::GetFrameBuffer() const
+	{
+		const uint32_t index = m_Graph.m_PassFrameBuffers[m_Pass];
+
+		ASSERT(index != RenderGraphHandle::INVALID, "Pass does not write any texture");
+		if(index == RenderGraphHandle::INVALID)
+			throw std::runtime_error("Pass does not write any texture");
+
+		return *m_Graph.m_FrameBuffers[index];
+	}
+
+	void RenderGraph::PassFrameBuffer::Reset(const std::vector<Ref<Texture>> &colors, const Ref<Texture> &depth, bool stencil)
+	{
+		for(uint32_t i = 0; i < colors.size(); ++i)
+			Attach(GL_COLOR_ATTACHMENT0 + i, colors[i]);
+
+		for(auto i = static_cast<uint32_t>(colors.size()); i < m_ColorAttachments; ++i)
+			Detach(GL_COLOR_ATTACHMENT0 + i);
+
+		const uint32_t depthAttachment = depth ? (stencil ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT) : 0;
+
+		if(m_DepthAttachment != 0 && m_DepthAttachment != depthAttachment)
+			Detach(m_DepthAttachment);
+
+		if(depth)
+			Attach(depthAttachment, depth);
+
+		m_ColorAttachments = static_cast<uint32_t>(colors.size());
+		m_DepthAttachment  = depthAttachment;
+
+		SetDrawBuffers(m_ColorAttachments);
+		CheckCompletion();
+	}
+
+	RenderGraph::RenderGraph(RenderTargetPool &pool) : m_Pool(pool) {}
+
+	void RenderGraph::AddPass(const std::string &name, const SetupFunction &setup, ExecuteFunction execute)
+	{
+		auto &pass   = m_Passes.emplace_back();
+		pass.Name    = name;
+		pass.Execute = std::move(execute);
+
+		RenderGraphBuilder builder(*this, static_cast<uint32_t>(m_Passes.size() - 1));
+		setup(builder);
+
+		m_Compiled = false;
+	}
+
+	RenderGraphHandle RenderGraph::Import(const std::string &name, const Ref<Texture> &texture)
+	{
+		ASSERT(texture, "Unable to import empty texture");
+		if(!texture)
+			throw std::invalid_argument("Unable to import empty texture");
+
+		auto &resource       = m_Resources.emplace_back();
+		resource.Name        = name;
+		resource.Imported    = texture;
+		resource.Description = {texture->Size(), texture->GetInternalFormat(), 0};
+
+		m_Compiled = false;
+		return CreateNode(static_cast<uint32_t>(m_Resources.size() - 1), 0, RenderGraphHandle::INVALID);
+	}
+
+	void RenderGraph::MarkOutput(RenderGraphHandle handle)
+	{
+		ASSERT(handle.Index < m_Nodes.size(), "Invalid render graph handle");
+		if(handle.Index >= m_Nodes.size())
+			throw std::invalid_argument("Invalid render graph handle");
+
+		m_Outputs.emplace_back(handle);
+		m_Compiled = false;
+	}
+
+	void RenderGraph::Compile()
+	{
+		Cull();
+		Allocate();
+
+		m_Compiled = true;
+
+		GL_LOG_TRACE(
+		             "Compiled render graph: {} passes ({} culled), {} resources on {} textures",
+		             m_Passes.size(),
+		             GetCulledPassCount(),
+		             m_Resources.size(),
+		             m_Physical.size()
+		            );
+	}
+
+	void RenderGraph::Execute()
+	{
+		if(!m_Compiled)
+			Compile();
+
+		for(auto &physical : m_Physical)
+			physical.Texture = m_Pool.AcquireTexture(physical.Description);
+
+		m_PassFrameBuffers.assign(m_Passes.size(), RenderGraphHandle::INVALID);
+
+		uint32_t frameBuffers = 0;
+		for(uint32_t i = 0; i < m_Passes.size(); ++i)
+		{
+			auto &pass = m_Passes[i];
+			if(pass.Culled)
+				continue;
+
+			GPU_ZONE(pass.Name);
+
+			if(!pass.Writes.empty())
+			{
+				std::vector<Ref<Texture>> colors;
+				Ref<Texture> depth;
+				bool stencil = false;
+
+				for(const uint32_t write : pass.Writes)
+				{
+					const auto &resource = m_Resources[m_Nodes[write].Resource];
+
+					if(IsDepthFormat(resource.Description.Format))
+					{
+						depth   = GetTexture(resource);
+						stencil = HasStencil(resource.Description.Format);
+					}
+					else
+						colors.emplace_back(GetTexture(resource));
+				}
+
+				if(frameBuffers == m_FrameBuffers.size())
+					m_FrameBuffers.emplace_back(MakeScope<PassFrameBuffer>());
+
+				m_PassFrameBuffers[i] = frameBuffers;
+				m_FrameBuffers[frameBuffers++]->Reset(colors, depth, stencil);
+			}
+
+			if(pass.Execute)
+				pass.Execute(RenderGraphResources(*this, i));
+		}
+
+		// Handing the textures back lets the pool recycle them next frame
+		for(auto &physical : m_Physical)
+			physical.Texture = nullptr;
+	}
+
+	void RenderGraph::Clear()
+	{
+		m_Resources.clear();
+		m_Nodes.clear();
+		m_Passes.clear();
+		m_Physical.clear();
+		m_Outputs.clear();
+		m_PassFrameBuffers.clear();
+
+		m_Compiled = false;
+	}
+
+	uint32_t RenderGraph::GetCulledPassCount() const
+	{
+		return static_cast<uint32_t>(std::ranges::count_if(m_Passes, [](const Pass &pass) { return pass.Culled; }));
+	}
+
+	bool RenderGraph::IsCulled(const std::string &pass) const
+	{
+		const auto it = std::ranges::find_if(m_Passes, [&pass](const Pass &value) { return value.Name == pass; });
+		return it != m_Passes.end() && it->Culled;
+	}
+
+	RenderGraphHandle RenderGraph::CreateNode(uint32_t resource, uint32_t version, uint32_t producer)
+	{
+		auto &node    = m_Nodes.emplace_back();
+		node.Resource = resource;
+		node.Version  = version;
+		node.Producer = producer;
+
+		return {static_cast<uint32_t>(m_Nodes.size() - 1)};
+	}
+
+	const RenderGraph::Resource& RenderGraph::GetResource(RenderGraphHandle handle) const
+	{
+		ASSERT(handle.Index < m_Nodes.size(), "Invalid render graph handle");
+		if(handle.Index >= m_Nodes.size())
+			throw std::invalid_argument("Invalid render graph handle");
+
+		return m_Resources[m_Nodes[handle.Index].Resource];
+	}
+
+	Ref<Texture> RenderGraph::GetTexture(const Resource &resource) const
+	{
+		if(resource.Imported)
+			return resource.Imported;
+
+		return resource.Physical != RenderGraphHandle::INVALID ? m_Physical[resource.Physical].Texture : nullptr;
+	}
+
+	// Reference counting over the pass/resource graph: a pass whose outputs are never read is culled, which may in turn
+	// leave the inputs of that pass unread
+	void RenderGraph::Cull()
+	{
+		for(auto &node : m_Nodes)
+			node.Readers = 0;
+
+		for(auto &pass : m_Passes)
+		{
+			pass.References = static_cast<uint32_t>(pass.Writes.size());
+			pass.Culled     = false;
+
+			for(const uint32_t read : pass.Reads)
+				++m_Nodes[read].Readers;
+		}
+
+		for(const auto &output : m_Outputs)
+			++m_Nodes[output.Index].Readers;
+
+		for(auto &node : m_Nodes)
+		{
+			if(m_Resources[node.Resource].Imported)
+				++node.Readers;
+		}
+
+		std::vector<uint32_t> unused;
+
+		const auto cull = [this, &unused](Pass &pass)
+		{
+			pass.Culled = true;
+
+			for(const uint32_t read : pass.Reads)
+			{
+				if(--m_Nodes[read].Readers == 0)
+					unused.emplace_back(read);
+			}
+		};
+
+		// Seeded before any pass is culled, cull() pushes the nodes it releases itself and a node pushed twice would take
+		// a second reference off its producer
+		for(uint32_t i = 0; i < m_Nodes.size(); ++i)
+		{
+			if(m_Nodes[i].Readers == 0)
+				unused.emplace_back(i);
+		}
+
+		for(auto &pass : m_Passes)
+		{
+			if(pass.References == 0 && !pass.SideEffect)
+				cull(pass);
+		}
+
+		while(!unused.empty())
+		{
+			const auto &node = m_Nodes[unused.back()];
+			unused.pop_back();
+
+			if(node.Producer == RenderGraphHandle::INVALID)
+				continue;
+
+			auto &pass = m_Passes[node.Producer];
+			if(pass.SideEffect || pass.Culled)
+				continue;
+
+			if(--pass.References == 0)
+				cull(pass);
+		}
+	}
+
+	// Transient resources share a texture when their lifetimes, measured in pass indices, do not overlap
+	void RenderGraph::Allocate()
+	{
+		m_Physical.clear();
+
+		for(auto &resource : m_Resources)
+		{
+			resource.Physical = RenderGraphHandle::INVALID;
+			resource.First    = RenderGraphHandle::INVALID;
+			resource.Last     = 0;
+		}
+
+		for(uint32_t i = 0; i < m_Passes.size(); ++i)
+		{
+			const auto &pass = m_Passes[i];
+			if(pass.Culled)
+				continue;
+
+			for(const auto *nodes : {&pass.Reads, &pass.Writes})
+			{
+				for(const uint32_t index : *nodes)
+				{
+					auto &resource = m_Resources[m_Nodes[index].Resource];
+
+					resource.First = std::min(resource.First, i);
+					resource.Last  = std::max(resource.Last, i);
+				}
+			}
+		}
+
+		std::vector<std::vector<uint32_t>> acquire(m_Passes.size());
+		std::vector<std::vector<uint32_t>> release(m_Passes.size());
+
+		for(uint32_t i = 0; i < m_Resources.size(); ++i)
+		{
+			const auto &resource = m_Resources[i];
+			if(resource.Imported || resource.First == RenderGraphHandle::INVALID)
+				continue;
+
+			acquire[resource.First].emplace_back(i);
+			release[resource.Last].emplace_back(i);
+		}
+
+		std::vector<uint32_t> available;
+
+		for(uint32_t i = 0; i < m_Passes.size(); ++i)
+		{
+			for(const uint32_t index : acquire[i])
+			{
+				auto &resource = m_Resources[index];
+
+				const auto it = std::ranges::find_if(
+				                                     available,
+				                                     [this, &resource](uint32_t physical)
+				                                     {
+					                                     return m_Physical[physical].Description == resource.Description;
+				                                     }
+				                                    );
+
+				if(it != available.end())
+				{
+					resource.Physical = *it;
+					available.erase(it);
+				}
+				else
+				{
+					resource.Physical = static_cast<uint32_t>(m_Physical.size());
+					m_Physical.emplace_back(Physical{resource.Description, nullptr});
+				}
+			}
+
+			for(const uint32_t index : release[i])
+				available.emplace_back(m_Resources[index].Physical);
+		}
+	}
+}
@@ -0,0 +1,174 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/OpenGL/FrameBuffer.h"
+#include "Engine/OpenGL/RenderTargetPool.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Game
+{
+	class Texture;
+	class RenderGraph;
+
+	struct RenderGraphHandle
+	{
+		static constexpr uint32_t INVALID = ~0u;
+
+		uint32_t Index = INVALID;
+
+		bool Valid() const { return Index != INVALID; }
+		operator bool() const { return Valid(); }
+
+		bool operator==(const RenderGraphHandle &other) const { return Index == other.Index; }
+		bool operator!=(const RenderGraphHandle &other) const { return Index != other.Index; }
+	};
+
+	// Declares what a pass consumes and produces, only valid inside the setup callback
+	class RenderGraphBuilder
+	{
+		RenderGraph &m_Graph;
+		uint32_t m_Pass;
+
+	public:
+		RenderGraphBuilder(RenderGraph &graph, uint32_t pass) : m_Graph(graph), m_Pass(pass) {}
+
+		// Creates a transient texture written by this pass
+		RenderGraphHandle Create(const std::string &name, const RenderTargetDescription &description);
+
+		RenderGraphHandle Read(RenderGraphHandle handle);
+
+		// Returns the new version of the resource, later passes have to use it to see this pass's output
+		RenderGraphHandle Write(RenderGraphHandle handle);
+
+		// The pass is never culled, for passes that draw to the default framebuffer or have other external effects
+		void SideEffect();
+	};
+
+	class RenderGraphResources
+	{
+		const RenderGraph &m_Graph;
+		uint32_t m_Pass;
+
+	public:
+		RenderGraphResources(const RenderGraph &graph, uint32_t pass) : m_Graph(graph), m_Pass(pass) {}
+
+		Ref<Texture> GetTexture(RenderGraphHandle handle) const;
+		const RenderTargetDescription& GetDescription(RenderGraphHandle handle) const;
+
+		// Framebuffer with every texture written by the pass attached, colors in declaration order
+		FrameBufferObject& GetFrameBuffer() const;
+	};
+
+	class RenderGraph
+	{
+		friend RenderGraphBuilder;
+		friend RenderGraphResources;
+
+	public:
+		using SetupFunction = std::function<void(RenderGraphBuilder&)>;
+		using ExecuteFunction = std::function<void(const RenderGraphResources&)>;
+
+	private:
+		class PassFrameBuffer: public FrameBufferObject
+		{
+			uint32_t m_ColorAttachments = 0;
+			uint32_t m_DepthAttachment  = 0;
+
+		public:
+			PassFrameBuffer() = default;
+
+			void Reset(const std::vector<Ref<Texture>> &colors, const Ref<Texture> &depth, bool stencil);
+		};
+
+		struct Resource
+		{
+			std::string Name;
+			RenderTargetDescription Description;
+
+			Ref<Texture> Imported;
+			uint32_t Physical = RenderGraphHandle::INVALID;
+
+			uint32_t First = RenderGraphHandle::INVALID;
+			uint32_t Last  = 0;
+		};
+
+		struct Node
+		{
+			uint32_t Resource = 0;
+			uint32_t Version  = 0;
+			uint32_t Producer = RenderGraphHandle::INVALID;
+			uint32_t Readers  = 0;
+		};
+
+		struct Pass
+		{
+			std::string Name;
+			ExecuteFunction Execute;
+
+			std::vector<uint32_t> Reads;
+			std::vector<uint32_t> Writes;
+
+			uint32_t References = 0;
+			bool SideEffect     = false;
+			bool Culled         = false;
+		};
+
+		struct Physical
+		{
+			RenderTargetDescription Description;
+			Ref<Texture> Texture;
+		};
+
+		RenderTargetPool &m_Pool;
+
+		std::vector<Resource> m_Resources;
+		std::vector<Node> m_Nodes;
+		std::vector<Pass> m_Passes;
+		std::vector<Physical> m_Physical;
+		std::vector<RenderGraphHandle> m_Outputs;
+
+		std::vector<Scope<PassFrameBuffer>> m_FrameBuffers;
+		std::vector<uint32_t> m_PassFrameBuffers;
+
+		bool m_Compiled = false;
+
+	public:
+		explicit RenderGraph(RenderTargetPool &pool);
+
+		RenderGraph(const RenderGraph&) = delete;
+		RenderGraph& operator=(const RenderGraph&) = delete;
+
+		void AddPass(const std::string &name, const SetupFunction &setup, ExecuteFunction execute);
+
+		// External textures are never aliased and passes writing them are kept alive
+		RenderGraphHandle Import(const std::string &name, const Ref<Texture> &texture);
+
+		// Keeps the producers of the resource alive during culling
+		void MarkOutput(RenderGraphHandle handle);
+
+		void Compile();
+		void Execute();
+
+		// Drops all passes and resources, cached framebuffers are kept for the next frame
+		void Clear();
+
+		uint32_t GetPassCount() const { return static_cast<uint32_t>(m_Passes.size()); }
+		uint32_t GetCulledPassCount() const;
+		uint32_t GetResourceCount() const { return static_cast<uint32_t>(m_Resources.size()); }
+		uint32_t GetPhysicalTextureCount() const { return static_cast<uint32_t>(m_Physical.size()); }
+
+		bool IsCulled(const std::string &pass) const;
+
+	private:
+		RenderGraphHandle CreateNode(uint32_t resource, uint32_t version, uint32_t producer);
+
+		const Resource& GetResource(RenderGraphHandle handle) const;
+		Ref<Texture> GetTexture(const Resource &resource) const;
+
+		void Cull();
+		void Allocate();
+	};
+}
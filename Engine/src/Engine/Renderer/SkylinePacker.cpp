@@ -0,0 +1,127 @@
+#include "pch.h"
+#include "Engine/Renderer/SkylinePacker.h"
+
+namespace Game
+{
+	SkylinePacker::SkylinePacker(const Vector2u &size)
+	{
+		Reset(size);
+	}
+
+	void SkylinePacker::Reset(const Vector2u &size)
+	{
+		m_Size = size;
+		Clear();
+	}
+
+	void SkylinePacker::Clear()
+	{
+		m_Skyline.clear();
+		m_Skyline.push_back(Node{0, 0, m_Size.Width});
+		m_UsedArea = 0;
+	}
+
+	bool SkylinePacker::Insert(const Vector2u &size, UIntRect &result)
+	{
+		if(size.Width == 0 || size.Height == 0 || size.Width > m_Size.Width || size.Height > m_Size.Height)
+			return false;
+
+		size_t bestIndex   = m_Skyline.size();
+		uint32_t bestTop   = std::numeric_limits<uint32_t>::max();
+		uint32_t bestWidth = std::numeric_limits<uint32_t>::max();
+		uint32_t bestY     = 0;
+
+		// Bottom-left heuristic: lowest resulting top edge, ties broken by the narrowest node
+		for(size_t i = 0; i < m_Skyline.size(); ++i)
+		{
+			uint32_t y = 0;
+			if(!Fit(i, size, y))
+				continue;
+
+			const uint32_t top = y + size.Height;
+			if(top < bestTop || (top == bestTop && m_Skyline[i].Width < bestWidth))
+			{
+				bestIndex = i;
+				bestTop   = top;
+				bestWidth = m_Skyline[i].Width;
+				bestY     = y;
+			}
+		}
+
+		if(bestIndex == m_Skyline.size())
+			return false;
+
+		result = UIntRect(m_Skyline[bestIndex].X, bestY, size.Width, size.Height);
+		Place(bestIndex, result);
+
+		m_UsedArea += static_cast<uint64_t>(size.Width) * size.Height;
+		return true;
+	}
+
+	float SkylinePacker::Occupancy() const
+	{
+		const uint64_t area = static_cast<uint64_t>(m_Size.Width) * m_Size.Height;
+		return area ? static_cast<float>(static_cast<double>(m_UsedArea) / static_cast<double>(area)) : 0.f;
+	}
+
+	bool SkylinePacker::Fit(size_t index, const Vector2u &size, uint32_t &y) const
+	{
+		const uint32_t x = m_Skyline[index].X;
+		if(x + size.Width > m_Size.Width)
+			return false;
+
+		uint32_t remaining = size.Width;
+		y                  = m_Skyline[index].Y;
+
+		for(size_t i = index; remaining > 0; ++i)
+		{
+			if(i >= m_Skyline.size())
+				return false;
+
+			y = std::max(y, m_Skyline[i].Y);
+			if(y + size.Height > m_Size.Height)
+				return false;
+
+			remaining -= std::min(remaining, m_Skyline[i].Width);
+		}
+
+		return true;
+	}
+
+	void SkylinePacker::Place(size_t index, const UIntRect &rect)
+	{
+		m_Skyline.insert(m_Skyline.begin() + static_cast<std::ptrdiff_t>(index), Node{rect.X, rect.Y + rect.Height, rect.Width});
+
+		for(size_t i = index + 1; i < m_Skyline.size();)
+		{
+			const auto &previous = m_Skyline[i - 1];
+			auto &node           = m_Skyline[i];
+
+			const uint32_t end = previous.X + previous.Width;
+			if(node.X >= end)
+				break;
+
+			const uint32_t shrink = end - node.X;
+			if(node.Width <= shrink)
+			{
+				m_Skyline.erase(m_Skyline.begin() + static_cast<std::ptrdiff_t>(i));
+				continue;
+			}
+
+			node.X += shrink;
+			node.Width -= shrink;
+			break;
+		}
+
+		for(size_t i = 0; i + 1 < m_Skyline.size();)
+		{
+			if(m_Skyline[i].Y == m_Skyline[i + 1].Y)
+			{
+				m_Skyline[i].Width += m_Skyline[i + 1].Width;
+				m_Skyline.erase(m_Skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+			}
+			else
+				++i;
+		}
+	}
+}
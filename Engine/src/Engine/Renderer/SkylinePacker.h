@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/Core/Rect.h"
+#include "Engine/Core/Vector2.h"
+
+#include <vector>
+
+namespace Game
+{
+	class SkylinePacker
+	{
+		struct Node
+		{
+			uint32_t X;
+			uint32_t Y;
+			uint32_t Width;
+		};
+
+		Vector2u m_Size;
+		std::vector<Node> m_Skyline;
+		uint64_t m_UsedArea = 0;
+
+	public:
+		explicit SkylinePacker(const Vector2u &size = {});
+
+		void Reset(const Vector2u &size);
+		void Clear();
+
+		bool Insert(const Vector2u &size, UIntRect &result);
+
+		const Vector2u& Size() const { return m_Size; }
+		float Occupancy() const;
+
+	private:
+		bool Fit(size_t index, const Vector2u &size, uint32_t &y) const;
+		void Place(size_t index, const UIntRect &rect);
+	};
+}
@@ -0,0 +1,302 @@
+#include "pch.h"
+#include "Engine/Renderer/TextureAtlas.h"
+
+#include <algorithm>
+
+namespace Game
+{
+	TextureAtlas::TextureAtlas(const TextureAtlasSpecification &specification) : m_Specification(specification)
+	{
+		ASSERT(m_Specification.PageSize.Width > 0 && m_Specification.PageSize.Height > 0, "Invalid page size");
+		if(m_Specification.PageSize.Width == 0 || m_Specification.PageSize.Height == 0)
+			throw std::invalid_argument("Invalid page size");
+
+		m_Specification.MipLevels = std::max(1u, m_Specification.MipLevels);
+		m_Specification.MaxPages  = std::max(1u, m_Specification.MaxPages);
+	}
+
+	const AtlasEntry* TextureAtlas::Insert(const std::string &name, const Image &image)
+	{
+		return Insert(name, Image(image));
+	}
+
+	const AtlasEntry* TextureAtlas::Insert(const std::string &name, Image &&image)
+	{
+		if(const auto it = m_Entries.find(name); it != m_Entries.end())
+		{
+			it->second.LastUsed = m_Frame;
+			return &it->second;
+		}
+
+		const auto size = AllocationSize(image.Size());
+		if(image.Width() == 0 || image.Height() == 0 || size.Width > m_Specification.PageSize.Width || size.Height >
+			m_Specification.PageSize.Height)
+		{
+			GL_LOG_WARN("Image \"{}\" ({}x{}) does not fit into atlas page", name, image.Width(), image.Height());
+			return nullptr;
+		}
+
+		m_Images[name] = std::move(image);
+
+		AtlasEntry entry;
+		entry.LastUsed = m_Frame;
+
+		if(!Place(name, entry) && !(Evict() && Place(name, entry)))
+		{
+			GL_LOG_WARN("Texture atlas is full, unable to insert \"{}\"", name);
+			m_Images.erase(name);
+
+			return nullptr;
+		}
+
+		return &(m_Entries[name] = entry);
+	}
+
+	const AtlasEntry* TextureAtlas::Find(const std::string &name)
+	{
+		const auto it = m_Entries.find(name);
+		if(it == m_Entries.end())
+			return nullptr;
+
+		it->second.LastUsed = m_Frame;
+		return &it->second;
+	}
+
+	void TextureAtlas::Remove(const std::string &name)
+	{
+		m_Entries.erase(name);
+		m_Images.erase(name);
+	}
+
+	void TextureAtlas::Clear()
+	{
+		m_Entries.clear();
+		m_Images.clear();
+		m_Pages.clear();
+	}
+
+	void TextureAtlas::Update()
+	{
+		for(auto &page : m_Pages)
+		{
+			if(page.Dirty)
+			{
+				page.Storage->GenerateMipMaps();
+				page.Dirty = false;
+			}
+		}
+
+		++m_Frame;
+	}
+
+	void TextureAtlas::Repack()
+	{
+		std::vector<std::string> names;
+		names.reserve(m_Entries.size());
+
+		for(const auto &[name, entry] : m_Entries)
+			names.push_back(name);
+
+		std::ranges::sort(
+		                  names,
+		                  [this](const std::string &left, const std::string &right)
+		                  {
+			                  const auto &a = m_Images.at(left);
+			                  const auto &b = m_Images.at(right);
+
+			                  return a.Height() != b.Height() ? a.Height() > b.Height() : a.Width() > b.Width();
+		                  }
+		                 );
+
+		for(auto &page : m_Pages)
+			page.Packer.Clear();
+
+		for(const auto &name : names)
+		{
+			if(!Place(name, m_Entries[name]))
+			{
+				GL_LOG_WARN("Unable to repack \"{}\", removing it from atlas", name);
+				Remove(name);
+			}
+		}
+
+		while(!m_Pages.empty() && m_Pages.back().Packer.Occupancy() == 0.f)
+			m_Pages.pop_back();
+
+		GL_LOG_DEBUG("Repacked texture atlas: {} entries on {} pages", m_Entries.size(), m_Pages.size());
+	}
+
+	const Ref<Texture>& TextureAtlas::GetPage(uint32_t page) const
+	{
+		ASSERT(page < m_Pages.size(), "Out of range");
+		if(page >= m_Pages.size())
+			throw std::out_of_range("Out of range");
+
+		return m_Pages[page].Storage;
+	}
+
+	float TextureAtlas::Occupancy(uint32_t page) const
+	{
+		ASSERT(page < m_Pages.size(), "Out of range");
+		if(page >= m_Pages.size())
+			throw std::out_of_range("Out of range");
+
+		return m_Pages[page].Packer.Occupancy();
+	}
+
+	bool TextureAtlas::Place(const std::string &name, AtlasEntry &entry)
+	{
+		for(uint32_t page = 0; page < m_Pages.size(); ++page)
+		{
+			if(PlaceIn(page, name, entry))
+				return true;
+		}
+
+		if(m_Pages.size() >= m_Specification.MaxPages)
+			return false;
+
+		AddPage();
+		return PlaceIn(static_cast<uint32_t>(m_Pages.size() - 1), name, entry);
+	}
+
+	bool TextureAtlas::PlaceIn(uint32_t page, const std::string &name, AtlasEntry &entry)
+	{
+		const auto &image = m_Images.at(name);
+
+		UIntRect rect;
+		if(!m_Pages[page].Packer.Insert(AllocationSize(image.Size()), rect))
+			return false;
+
+		Upload(page, rect, image);
+
+		const auto &size      = m_Specification.PageSize;
+		const uint32_t padding = m_Specification.Padding;
+
+		entry.Page = page;
+		entry.Rect = UIntRect(rect.X + padding, rect.Y + padding, image.Width(), image.Height());
+		entry.UV   = FloatRect(
+		                       static_cast<float>(entry.Rect.X) / static_cast<float>(size.Width),
+		                       static_cast<float>(entry.Rect.Y) / static_cast<float>(size.Height),
+		                       static_cast<float>(entry.Rect.Width) / static_cast<float>(size.Width),
+		                       static_cast<float>(entry.Rect.Height) / static_cast<float>(size.Height)
+		                      );
+
+		return true;
+	}
+
+	bool TextureAtlas::Evict()
+	{
+		std::vector<uint64_t> stale(m_Pages.size(), 0);
+
+		for(const auto &[name, entry] : m_Entries)
+		{
+			if(m_Frame - entry.LastUsed > m_Specification.EvictionAge)
+				stale[entry.Page] += static_cast<uint64_t>(entry.Rect.Width) * entry.Rect.Height;
+		}
+
+		const auto best = std::ranges::max_element(stale);
+		if(best == stale.end() || *best == 0)
+			return false;
+
+		const auto page = static_cast<uint32_t>(std::distance(stale.begin(), best));
+
+		uint32_t evicted = 0;
+		for(auto it = m_Entries.begin(); it != m_Entries.end();)
+		{
+			if(it->second.Page == page && m_Frame - it->second.LastUsed > m_Specification.EvictionAge)
+			{
+				m_Images.erase(it->first);
+				it = m_Entries.erase(it);
+				++evicted;
+			}
+			else
+				++it;
+		}
+
+		GL_LOG_DEBUG("Evicted {} entries from atlas page {}", evicted, page);
+
+		RepackPage(page);
+		return true;
+	}
+
+	void TextureAtlas::RepackPage(uint32_t page)
+	{
+		std::vector<std::string> names;
+
+		for(const auto &[name, entry] : m_Entries)
+		{
+			if(entry.Page == page)
+				names.push_back(name);
+		}
+
+		std::ranges::sort(
+		                  names,
+		                  [this](const std::string &left, const std::string &right)
+		                  {
+			                  return m_Images.at(left).Height() > m_Images.at(right).Height();
+		                  }
+		                 );
+
+		m_Pages[page].Packer.Clear();
+
+		for(const auto &name : names)
+		{
+			auto &entry = m_Entries[name];
+
+			if(!PlaceIn(page, name, entry) && !Place(name, entry))
+			{
+				GL_LOG_WARN("Unable to repack \"{}\", removing it from atlas", name);
+				Remove(name);
+			}
+		}
+	}
+
+	void TextureAtlas::Upload(uint32_t page, const UIntRect &rect, const Image &image)
+	{
+		const int32_t padding = static_cast<int32_t>(m_Specification.Padding);
+		const int32_t width   = static_cast<int32_t>(image.Width());
+		const int32_t height  = static_cast<int32_t>(image.Height());
+
+		// Extrude the border texels into the padding so filtering never samples a neighbour
+		Image block(rect.Width, rect.Height);
+		for(uint32_t y = 0; y < rect.Height; ++y)
+		{
+			const int32_t sourceY = std::clamp(static_cast<int32_t>(y) - padding, 0, height - 1);
+
+			for(uint32_t x = 0; x < rect.Width; ++x)
+			{
+				const int32_t sourceX = std::clamp(static_cast<int32_t>(x) - padding, 0, width - 1);
+				block.SetPixel(x, y, image.GetPixel(static_cast<uint32_t>(sourceX), static_cast<uint32_t>(sourceY)));
+			}
+		}
+
+		auto &target = m_Pages[page];
+		target.Storage->Update(block.GetPixels(), block.Size(), Vector2i(static_cast<int32_t>(rect.X), static_cast<int32_t>(rect.Y)));
+		target.Dirty = m_Specification.MipLevels > 1;
+	}
+
+	Vector2u TextureAtlas::AllocationSize(const Vector2u &size) const
+	{
+		const uint32_t alignment = 1u << (m_Specification.MipLevels - 1);
+		const uint32_t padding   = m_Specification.Padding * 2;
+
+		return {
+			(size.Width + padding + alignment - 1) / alignment * alignment,
+			(size.Height + padding + alignment - 1) / alignment * alignment
+		};
+	}
+
+	TextureAtlas::Page& TextureAtlas::AddPage()
+	{
+		auto &page = m_Pages.emplace_back();
+
+		page.Storage = MakeRef<Texture>(m_Specification.PageSize, m_Specification.MipLevels);
+		page.Storage->SetWrapping(Wrapping::ClampEdge, Wrapping::ClampEdge);
+		page.Storage->SetFilters(m_Specification.MipLevels > 1 ? Filter::LinearMipmapLinear : Filter::Linear, Filter::Linear);
+		page.Packer.Reset(m_Specification.PageSize);
+
+		GL_LOG_DEBUG("Created texture atlas page {} ({}x{})", m_Pages.size() - 1, m_Specification.PageSize.Width, m_Specification.PageSize.Height);
+
+		return page;
+	}
+}
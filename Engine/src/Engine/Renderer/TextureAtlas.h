@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/Core/Image.h"
+#include "Engine/Core/Rect.h"
+#include "Engine/OpenGL/Texture.h"
+#include "Engine/Renderer/SkylinePacker.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Game
+{
+	struct AtlasEntry
+	{
+		uint32_t Page = 0;
+
+		UIntRect Rect;
+		FloatRect UV;
+
+		uint64_t LastUsed = 0;
+	};
+
+	struct TextureAtlasSpecification
+	{
+		Vector2u PageSize = {2048, 2048};
+
+		uint32_t Padding  = 2;
+		uint32_t MaxPages = 4;
+
+		// Allocations are aligned to 2^(MipLevels - 1) texels so lower mips of neighbours do not bleed into each other
+		uint32_t MipLevels = 1;
+
+		// Entries unused for this many frames may be evicted when every page is full
+		uint64_t EvictionAge = 60;
+	};
+
+	class TextureAtlas
+	{
+		struct Page
+		{
+			Ref<Texture> Storage;
+			SkylinePacker Packer;
+
+			bool Dirty = false;
+		};
+
+		TextureAtlasSpecification m_Specification;
+
+		std::vector<Page> m_Pages;
+		std::unordered_map<std::string, AtlasEntry> m_Entries;
+		std::unordered_map<std::string, Image> m_Images;
+
+		uint64_t m_Frame = 0;
+
+	public:
+		explicit TextureAtlas(const TextureAtlasSpecification &specification = {});
+
+		TextureAtlas(const TextureAtlas&) = delete;
+		TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+		// Entries are owned by the atlas, the pointer is valid only until the next Insert, Remove, Clear or Repack, an insert
+		// may evict and a repack moves entries, copy the entry to keep it. nullptr when the image does not fit
+		const AtlasEntry* Insert(const std::string &name, const Image &image);
+		const AtlasEntry* Insert(const std::string &name, Image &&image);
+
+		// Same lifetime as the pointer Insert returns, nullptr for an unknown name
+		const AtlasEntry* Find(const std::string &name);
+		bool Contains(const std::string &name) const { return m_Entries.contains(name); }
+
+		void Remove(const std::string &name);
+		void Clear();
+
+		void Update();
+		void Repack();
+
+		uint32_t PageCount() const { return static_cast<uint32_t>(m_Pages.size()); }
+		const Ref<Texture>& GetPage(uint32_t page) const;
+		const Ref<Texture>& GetTexture(const AtlasEntry &entry) const { return GetPage(entry.Page); }
+
+		float Occupancy(uint32_t page) const;
+		size_t Size() const { return m_Entries.size(); }
+
+		const TextureAtlasSpecification& GetSpecification() const { return m_Specification; }
+
+	private:
+		bool Place(const std::string &name, AtlasEntry &entry);
+		bool PlaceIn(uint32_t page, const std::string &name, AtlasEntry &entry);
+
+		bool Evict();
+		void RepackPage(uint32_t page);
+
+		void Upload(uint32_t page, const UIntRect &rect, const Image &image);
+		Vector2u AllocationSize(const Vector2u &size) const;
+
+		Page& AddPage();
+	};
+}
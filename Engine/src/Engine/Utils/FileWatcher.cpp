@@ -0,0 +1,410 @@
+#include "pch.h"
+#include "Engine/Utils/FileWatcher.h"
+
+#if defined(__linux__)
+	#include <poll.h>
+	#include <unistd.h>
+	#include <sys/eventfd.h>
+	#include <sys/inotify.h>
+#endif
+
+namespace Game
+{
+	namespace Priv
+	{
+#if defined(_WIN32)
+		class FileWatcherImpl
+		{
+			FileWatcher &m_Watcher;
+
+			HANDLE m_Wake = nullptr;
+			std::unordered_map<std::string, std::filesystem::file_time_type> m_Times;
+
+		public:
+			explicit FileWatcherImpl(FileWatcher &watcher) : m_Watcher(watcher)
+			{
+				m_Wake = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+			}
+
+			~FileWatcherImpl()
+			{
+				CloseHandle(m_Wake);
+			}
+
+			void Add(const std::string &directory) { Wake(); }
+			void Remove(const std::string &directory) { Wake(); }
+
+			void Wake() { SetEvent(m_Wake); }
+
+			void Run()
+			{
+				std::vector<std::string> directories;
+				std::vector<HANDLE> handles;
+
+				while(m_Watcher.m_Running)
+				{
+					for(size_t i = 1; i < handles.size(); ++i)
+						FindCloseChangeNotification(handles[i]);
+
+					directories.clear();
+					handles.assign(1, m_Wake);
+
+					{
+						std::scoped_lock lock(m_Watcher.m_Mutex);
+
+						for(const auto &[directory, files] : m_Watcher.m_Directories)
+						{
+							if(handles.size() == MAXIMUM_WAIT_OBJECTS)
+							{
+								LOG_WARN("File watcher is limited to {} directories", MAXIMUM_WAIT_OBJECTS - 1);
+								break;
+							}
+
+							const HANDLE handle = FindFirstChangeNotificationW(
+							                                                   std::filesystem::path(directory).c_str(),
+							                                                   FALSE,
+							                                                   FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME
+							                                                  );
+
+							if(handle == INVALID_HANDLE_VALUE)
+								continue;
+
+							directories.emplace_back(directory);
+							handles.emplace_back(handle);
+
+							for(const auto &file : files)
+								m_Times.try_emplace(file, GetTime(file));
+						}
+					}
+
+					while(m_Watcher.m_Running)
+					{
+						const DWORD result = WaitForMultipleObjects(static_cast<DWORD>(handles.size()), handles.data(), FALSE, INFINITE);
+
+						if(result == WAIT_OBJECT_0 || result >= WAIT_OBJECT_0 + handles.size())
+							break;
+
+						const size_t index = result - WAIT_OBJECT_0;
+						Scan(directories[index - 1]);
+
+						FindNextChangeNotification(handles[index]);
+					}
+				}
+
+				for(size_t i = 1; i < handles.size(); ++i)
+					FindCloseChangeNotification(handles[i]);
+			}
+
+		private:
+			static std::filesystem::file_time_type GetTime(const std::string &file)
+			{
+				std::error_code error;
+				return std::filesystem::last_write_time(file, error);
+			}
+
+			void Scan(const std::string &directory)
+			{
+				std::vector<std::string> files;
+
+				{
+					std::scoped_lock lock(m_Watcher.m_Mutex);
+
+					const auto it = m_Watcher.m_Directories.find(directory);
+					if(it == m_Watcher.m_Directories.end())
+						return;
+
+					files.assign(it->second.begin(), it->second.end());
+				}
+
+				for(const auto &file : files)
+				{
+					const auto time = GetTime(file);
+					auto &last      = m_Times[file];
+
+					if(time != last)
+					{
+						last = time;
+						m_Watcher.Notify(directory, file);
+					}
+				}
+			}
+		};
+#elif defined(__linux__)
+		class FileWatcherImpl
+		{
+			FileWatcher &m_Watcher;
+
+			int m_Inotify = -1;
+			int m_Wake    = -1;
+
+			std::unordered_map<int, std::string> m_Descriptors;
+			std::unordered_map<std::string, int> m_Directories;
+			std::mutex m_Mutex;
+
+		public:
+			explicit FileWatcherImpl(FileWatcher &watcher) : m_Watcher(watcher)
+			{
+				m_Inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+				m_Wake    = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+				if(m_Inotify < 0)
+					LOG_ERROR("Unable to initialize inotify");
+			}
+
+			~FileWatcherImpl()
+			{
+				if(m_Inotify >= 0)
+					close(m_Inotify);
+				if(m_Wake >= 0)
+					close(m_Wake);
+			}
+
+			void Add(const std::string &directory)
+			{
+				if(m_Inotify < 0)
+					return;
+
+				const int descriptor = inotify_add_watch(m_Inotify, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+
+				if(descriptor < 0)
+				{
+					LOG_WARN("Unable to watch directory \"{}\"", directory);
+					return;
+				}
+
+				std::scoped_lock lock(m_Mutex);
+				m_Descriptors[descriptor] = directory;
+				m_Directories[directory]  = descriptor;
+			}
+
+			void Remove(const std::string &directory)
+			{
+				std::scoped_lock lock(m_Mutex);
+
+				const auto it = m_Directories.find(directory);
+				if(it == m_Directories.end())
+					return;
+
+				inotify_rm_watch(m_Inotify, it->second);
+				m_Descriptors.erase(it->second);
+				m_Directories.erase(it);
+			}
+
+			void Wake()
+			{
+				const uint64_t value = 1;
+				[[maybe_unused]] const auto result = write(m_Wake, &value, sizeof(value));
+			}
+
+			void Run()
+			{
+				alignas(inotify_event) char buffer[4096];
+
+				pollfd descriptors[2] = {{m_Inotify, POLLIN, 0}, {m_Wake, POLLIN, 0}};
+
+				while(m_Watcher.m_Running)
+				{
+					if(poll(descriptors, 2, -1) <= 0)
+						continue;
+
+					if(descriptors[1].revents & POLLIN)
+					{
+						uint64_t value = 0;
+						[[maybe_unused]] const auto result = read(m_Wake, &value, sizeof(value));
+					}
+
+					if(!(descriptors[0].revents & POLLIN))
+						continue;
+
+					ssize_t length = 0;
+					while((length = read(m_Inotify, buffer, sizeof(buffer))) > 0)
+					{
+						for(char *pointer = buffer; pointer < buffer + length;)
+						{
+							const auto event = reinterpret_cast<const inotify_event*>(pointer);
+							pointer += sizeof(inotify_event) + event->len;
+
+							if(event->len == 0)
+								continue;
+
+							std::string directory;
+
+							{
+								std::scoped_lock lock(m_Mutex);
+
+								const auto it = m_Descriptors.find(event->wd);
+								if(it == m_Descriptors.end())
+									continue;
+
+								directory = it->second;
+							}
+
+							m_Watcher.Notify(directory, (std::filesystem::path(directory) / event->name).string());
+						}
+					}
+				}
+			}
+		};
+#else
+		class FileWatcherImpl
+		{
+			FileWatcher &m_Watcher;
+
+			std::unordered_map<std::string, std::filesystem::file_time_type> m_Times;
+
+		public:
+			explicit FileWatcherImpl(FileWatcher &watcher) : m_Watcher(watcher) {}
+
+			void Add(const std::string &directory) {}
+			void Remove(const std::string &directory) {}
+			void Wake() {}
+
+			void Run()
+			{
+				while(m_Watcher.m_Running)
+				{
+					std::vector<std::pair<std::string, std::string>> files;
+
+					{
+						std::scoped_lock lock(m_Watcher.m_Mutex);
+
+						for(const auto &[directory, names] : m_Watcher.m_Directories)
+							for(const auto &name : names)
+								files.emplace_back(directory, name);
+					}
+
+					for(const auto &[directory, file] : files)
+					{
+						std::error_code error;
+						const auto time = std::filesystem::last_write_time(file, error);
+
+						auto [it, inserted] = m_Times.try_emplace(file, time);
+						if(!inserted && it->second != time)
+						{
+							it->second = time;
+							m_Watcher.Notify(directory, file);
+						}
+					}
+
+					std::this_thread::sleep_for(std::chrono::milliseconds(500));
+				}
+			}
+		};
+#endif
+	}
+
+	FileWatcher::FileWatcher()
+	{
+		m_Impl    = MakeScope<Priv::FileWatcherImpl>(*this);
+		m_Running = true;
+		m_Thread  = std::thread([this]() { Run(); });
+	}
+
+	FileWatcher::~FileWatcher()
+	{
+		m_Running = false;
+		m_Impl->Wake();
+
+		if(m_Thread.joinable())
+			m_Thread.join();
+	}
+
+	void FileWatcher::Watch(const std::filesystem::path &path)
+	{
+		const auto normalized = Normalize(path);
+		const auto directory  = normalized.parent_path().string();
+
+		bool added = false;
+
+		{
+			std::scoped_lock lock(m_Mutex);
+
+			auto [it, inserted] = m_Directories.try_emplace(directory);
+			added               = inserted;
+
+			it->second.emplace(normalized.string());
+		}
+
+		if(added)
+		{
+			LOG_DEBUG("Watching directory \"{}\"", directory);
+			m_Impl->Add(directory);
+		}
+	}
+
+	void FileWatcher::Unwatch(const std::filesystem::path &path)
+	{
+		const auto normalized = Normalize(path);
+		const auto directory  = normalized.parent_path().string();
+
+		bool removed = false;
+
+		{
+			std::scoped_lock lock(m_Mutex);
+
+			const auto it = m_Directories.find(directory);
+			if(it == m_Directories.end())
+				return;
+
+			it->second.erase(normalized.string());
+
+			if(it->second.empty())
+			{
+				m_Directories.erase(it);
+				removed = true;
+			}
+		}
+
+		if(removed)
+			m_Impl->Remove(directory);
+	}
+
+	bool FileWatcher::IsWatched(const std::filesystem::path &path)
+	{
+		const auto normalized = Normalize(path);
+
+		std::scoped_lock lock(m_Mutex);
+
+		const auto it = m_Directories.find(normalized.parent_path().string());
+		return it != m_Directories.end() && it->second.contains(normalized.string());
+	}
+
+	std::vector<std::filesystem::path> FileWatcher::PollChanges()
+	{
+		if(!HasChanges())
+			return {};
+
+		std::scoped_lock lock(m_Mutex);
+
+		std::vector<std::filesystem::path> changes(m_Changed.begin(), m_Changed.end());
+		m_Changed.clear();
+		m_Dirty.store(false, std::memory_order_release);
+
+		return changes;
+	}
+
+	void FileWatcher::Run()
+	{
+		m_Impl->Run();
+	}
+
+	void FileWatcher::Notify(const std::string &directory, const std::string &file)
+	{
+		std::scoped_lock lock(m_Mutex);
+
+		const auto it = m_Directories.find(directory);
+		if(it == m_Directories.end() || !it->second.contains(file))
+			return;
+
+		m_Changed.emplace(file);
+		m_Dirty.store(true, std::memory_order_release);
+	}
+
+	std::filesystem::path FileWatcher::Normalize(const std::filesystem::path &path)
+	{
+		std::error_code error;
+		auto normalized = std::filesystem::weakly_canonical(path, error);
+
+		return error ? std::filesystem::absolute(path, error) : normalized;
+	}
+}
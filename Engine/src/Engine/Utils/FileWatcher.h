@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+
+#include <atomic>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Game
+{
+	namespace Priv
+	{
+		class FileWatcherImpl;
+	}
+
+	class FileWatcher
+	{
+		friend class Priv::FileWatcherImpl;
+
+		std::unordered_map<std::string, std::unordered_set<std::string>> m_Directories;
+		std::unordered_set<std::string> m_Changed;
+
+		std::mutex m_Mutex;
+		std::atomic<bool> m_Dirty   = false;
+		std::atomic<bool> m_Running = false;
+
+		Scope<Priv::FileWatcherImpl> m_Impl;
+		std::thread m_Thread;
+
+	public:
+		FileWatcher();
+		~FileWatcher();
+
+		FileWatcher(const FileWatcher&) = delete;
+		FileWatcher(FileWatcher&&) = delete;
+
+		FileWatcher& operator=(const FileWatcher&) = delete;
+		FileWatcher& operator=(FileWatcher&&) = delete;
+
+		void Watch(const std::filesystem::path &path);
+		void Unwatch(const std::filesystem::path &path);
+
+		bool IsWatched(const std::filesystem::path &path);
+
+		bool HasChanges() const { return m_Dirty.load(std::memory_order_acquire); }
+		std::vector<std::filesystem::path> PollChanges();
+
+	private:
+		void Run();
+		void Notify(const std::string &directory, const std::string &file);
+
+		static std::filesystem::path Normalize(const std::filesystem::path &path);
+	};
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace Game
+{
+	constexpr uint64_t HASH_OFFSET_BASIS = 0xcbf29ce484222325ull;
+	constexpr uint64_t HASH_PRIME        = 0x100000001b3ull;
+
+	constexpr uint64_t Hash(const std::string_view string, uint64_t seed = HASH_OFFSET_BASIS)
+	{
+		uint64_t hash = seed;
+
+		for(const char c : string)
+		{
+			hash ^= static_cast<uint8_t>(c);
+			hash *= HASH_PRIME;
+		}
+
+		return hash;
+	}
+
+	inline uint64_t Hash(const void *data, size_t size, uint64_t seed = HASH_OFFSET_BASIS)
+	{
+		const auto bytes = static_cast<const uint8_t*>(data);
+		uint64_t hash    = seed;
+
+		for(size_t i = 0; i < size; ++i)
+		{
+			hash ^= bytes[i];
+			hash *= HASH_PRIME;
+		}
+
+		return hash;
+	}
+
+	template <typename Type>
+	uint64_t HashValue(const Type &value, uint64_t seed = HASH_OFFSET_BASIS)
+	{
+		return Hash(&value, sizeof(Type), seed);
+	}
+
+	constexpr uint64_t HashCombine(uint64_t seed, uint64_t hash)
+	{
+		return seed ^ (hash + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+	}
+
+	class HashedString
+	{
+		uint64_t m_Hash = 0;
+
+	public:
+		constexpr HashedString() = default;
+
+		template <size_t Size>
+		explicit consteval HashedString(const char (&string)[Size]) : m_Hash(Hash(std::string_view(string, Size - 1))) {}
+
+		explicit constexpr HashedString(const std::string_view string) : m_Hash(Hash(string)) {}
+
+		constexpr uint64_t Value() const { return m_Hash; }
+		explicit constexpr operator uint64_t() const { return m_Hash; }
+
+		constexpr bool operator==(const HashedString &other) const { return m_Hash == other.m_Hash; }
+		constexpr bool operator!=(const HashedString &other) const { return m_Hash != other.m_Hash; }
+	};
+
+	struct IdentityHash
+	{
+		size_t operator()(uint64_t value) const { return static_cast<size_t>(value); }
+	};
+
+	namespace Literals
+	{
+		consteval HashedString operator"" _Hash(const char *string, size_t size)
+		{
+			return HashedString(std::string_view(string, size));
+		}
+	}
+}